@@ -1,5 +1,6 @@
 #include "Client.hpp"
 #include <raylib.h>
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include "AssetManager.hpp"
@@ -450,23 +451,37 @@ namespace client {
   }
 
   /**
-   * @brief Transmit the local player's current input flags to the server.
+   * @brief Sample the held movement input for a new client tick and send the
+   * last INPUT_REDUNDANCY ticks of input to the server.
    *
-   * If the client has not been assigned a local player ID, the call is
-   * ignored.
-   *
-   * @param input Bitmask of player input flags (each bit represents an input
-   * action).
+   * Meant to be called once per tick from the network loop. Nothing is sent
+   * while every input in the window is idle, so an idle player costs no
+   * bandwidth once the last movement has been repeated enough times. If the
+   * client has not been assigned a local player ID, the call is ignored.
    */
-  void Client::sendInput(std::uint8_t input) {
+  void Client::sendInput() {
     if (getPlayerId() == INVALID_ID) {
-      TraceLog(LOG_WARNING, "[SEND INPUT] Player ID not assigned yet");
       return;
     }
 
+    if (_inputHistoryCount == _inputHistory.size()) {
+      std::move(_inputHistory.begin() + 1, _inputHistory.end(),
+                _inputHistory.begin());
+      _inputHistoryCount--;
+    }
+    _inputHistory[_inputHistoryCount++] =
+        _movementInput.load(std::memory_order_relaxed);
+    _inputTick++;
+
+    if (std::all_of(_inputHistory.begin(),
+                    _inputHistory.begin() + _inputHistoryCount,
+                    [](std::uint8_t input) { return input == 0; }))
+      return;
+
     try {
       PlayerInputPacket packet = PacketBuilder::makePlayerInput(
-          input, _sequence_number.load(std::memory_order_acquire));
+          _inputHistory.data(), _inputHistoryCount, _inputTick,
+          _sequence_number.load(std::memory_order_acquire));
 
       send(packet);
 
@@ -507,94 +522,134 @@ namespace client {
    *
    * Creates an unacknowledged-packet entry containing the serialized packet
    * bytes, initializes its resend count to zero, sets its last-sent timestamp
-   * to now, and stores it in the client's unacknowledged packet map using the
-   * provided sequence number.
+   * to now, matches it to the datagram that just carried it through the ack
+   * channel's send history, and stores it in the client's unacknowledged
+   * packet ring. Its first retransmission is scheduled one RTO from now on
+   * the resend wheel, under the packet's tracking number.
    *
-   * @param sequence_number Sequence identifier for the packet used as the map
-   * key.
+   * @param sequence_number Sequence number the packet was built with.
    * @param packetData Shared pointer to the serialized packet byte buffer to be
    * resent if unacknowledged.
    */
   void Client::addUnacknowledgedPacket(
       std::uint32_t sequence_number,
       std::shared_ptr<std::vector<uint8_t>> packetData) {
+    auto ackSequence =
+        _networkManager.getAckChannel().findSent(packetData.get());
+    const auto now = std::chrono::steady_clock::now();
     std::lock_guard<std::mutex> lock(_unacknowledgedPacketsMutex);
     UnacknowledgedPacket packet;
-    packet.data = packetData;
+    packet.data = std::move(packetData);
+    packet.sequence_number = sequence_number;
     packet.resend_count = 0;
-    packet.last_sent = std::chrono::steady_clock::now();
-    _unacknowledged_packets[sequence_number] = packet;
+    packet.last_sent = now;
+    packet.ack_sequence = ackSequence;
+    packet.resend_at = now + _rtt.getRto();
+    const auto resendAt = packet.resend_at;
+    _resendWheel.schedule(resendAt,
+                          _unacknowledged_packets.insert(std::move(packet)));
   }
 
   /**
-   * @brief Remove the unacknowledged packet entry for a given sequence number.
+   * @brief Process the ack header of a datagram received from the server.
    *
-   * Erases the stored unacknowledged packet identified by @p sequence_number.
-   * If no entry exists for that sequence number, the function has no effect.
+   * Records the datagram in the connection's ack channel, so the next
+   * datagram sent acknowledges it, and drops every unacknowledged packet
+   * whose last datagram the header acknowledges. The most recently sent of
+   * those that were never retransmitted gives an RTT sample.
    *
-   * @param sequence_number Sequence number of the packet to remove.
+   * @param header Ack header read from the received datagram.
    */
-  void Client::removeAcknowledgedPacket(std::uint32_t sequence_number) {
+  void Client::handleAckHeader(const network::AckHeader &header) {
+    _networkManager.getAckChannel().receive(header);
+    const auto now = std::chrono::steady_clock::now();
+    std::optional<std::chrono::steady_clock::duration> sample;
     std::lock_guard<std::mutex> lock(_unacknowledgedPacketsMutex);
-    auto it = _unacknowledged_packets.find(sequence_number);
-    if (it != _unacknowledged_packets.end())
-      _unacknowledged_packets.erase(it);
+    _unacknowledged_packets.eraseIf([&](const UnacknowledgedPacket &packet) {
+      if (!packet.ack_sequence || !header.acknowledges(*packet.ack_sequence))
+        return false;
+      const auto elapsed = now - packet.last_sent;
+      if (packet.resend_count == 0 && (!sample || elapsed < *sample))
+        sample = elapsed;
+      return true;
+    });
+    if (sample)
+      _rtt.addSample(
+          std::chrono::duration_cast<std::chrono::milliseconds>(*sample));
   }
 
   /**
-   * @brief Resends unacknowledged packets that are eligible for retransmission.
+   * @brief Fold a Ping/Pong round trip into the RTT estimate the
+   * retransmission timeout is derived from.
+   */
+  void Client::addRttSample(std::chrono::milliseconds sample) {
+    std::lock_guard<std::mutex> lock(_unacknowledgedPacketsMutex);
+    _rtt.addSample(sample);
+  }
+
+  /**
+   * @brief Resends the unacknowledged packets whose retransmission timeout
+   * expired.
    *
-   * Scans the client's unacknowledged-packet table and resends entries whose
-   * last-sent time is older than the minimum resend interval. Each resent entry
-   * has its `resend_count` incremented and `last_sent` updated. Entries that
-   * reach `MAX_RESEND_ATTEMPTS` are removed and will not be retried.
+   * Advances the resend wheel to now, so only packets whose deadline passed
+   * are looked at. Each resent entry has its `resend_count` incremented,
+   * `last_sent` updated and is rescheduled one backed-off RTO later (doubled
+   * per attempt, up to `MAX_RTO_MS`). Entries that reach `MAX_RESEND_ATTEMPTS`
+   * are removed and will not be retried.
    *
    * @details
-   * - Resent packets are transmitted via the client's network manager.
-   * - Constants used: `MIN_RESEND_PACKET_DELAY` (minimum interval) and
-   * `MAX_RESEND_ATTEMPTS` (maximum attempts).
+   * - Resent packets are transmitted via the client's network manager, each
+   * in a new datagram whose ack sequence replaces the packet's previous one.
+   * - A datagram holding only an ack header is sent when the server has been
+   * owed an acknowledgement for `ACK_FLUSH_DELAY_MS`, so its reliable packets
+   * are acknowledged even without other traffic.
    */
   void Client::resendUnacknowledgedPackets() {
-    const auto MIN_RESEND_INTERVAL =
-        std::chrono::milliseconds(MIN_RESEND_PACKET_DELAY);
     const auto now = std::chrono::steady_clock::now();
 
-    std::vector<std::shared_ptr<std::vector<uint8_t>>> toSend;
-    std::vector<uint32_t> toDrop;
+    std::vector<std::pair<uint32_t, std::shared_ptr<std::vector<uint8_t>>>>
+        toSend;
     {
       std::lock_guard<std::mutex> lock(_unacknowledgedPacketsMutex);
-      for (auto &[seq, packet] : _unacknowledged_packets) {
-        if (now - packet.last_sent < MIN_RESEND_INTERVAL)
-          continue;
-        if (packet.resend_count >= MAX_RESEND_ATTEMPTS) {
-          toDrop.push_back(seq);
-          continue;
+      _resendWheel.advance(now, [&](std::uint32_t number) {
+        UnacknowledgedPacket *packet = _unacknowledged_packets.find(number);
+        if (packet == nullptr || packet->resend_at > now)
+          return;
+        if (packet->resend_count >= MAX_RESEND_ATTEMPTS) {
+          _unacknowledged_packets.erase(number);
+          return;
         }
-        packet.resend_count++;
-        packet.last_sent = now;
-        toSend.push_back(packet.data);
-      }
-      for (auto seq : toDrop) {
-        _unacknowledged_packets.erase(seq);
-      }
+        packet->resend_count++;
+        packet->last_sent = now;
+        packet->resend_at = now + _rtt.getBackoffRto(packet->resend_count);
+        _resendWheel.schedule(packet->resend_at, number);
+        toSend.emplace_back(number, packet->data);
+      });
     }
-    for (auto &buf : toSend) {
+    auto &acks = _networkManager.getAckChannel();
+    for (auto &[number, buf] : toSend) {
       _networkManager.send(buf);
+      auto ackSequence = acks.findSent(buf.get());
+      std::lock_guard<std::mutex> lock(_unacknowledgedPacketsMutex);
+      if (auto *packet = _unacknowledged_packets.find(number))
+        packet->ack_sequence = ackSequence;
     }
+    if (acks.hasPendingAck(std::chrono::milliseconds(ACK_FLUSH_DELAY_MS)) &&
+        _networkManager.isConnected())
+      _networkManager.send(std::make_shared<std::vector<std::uint8_t>>());
   }
 
   /**
-   * @brief Runs the background loop that periodically resends unacknowledged
-   * packets.
+   * @brief Runs the background loop that drives the resend wheel.
    *
-   * Continuously sleeps for a fixed delay and invokes the resend routine while
+   * Wakes up every `RESEND_WHEEL_TICK_MS` and invokes the resend routine while
    * the resend thread running flag remains set; exits when the running flag is
    * cleared.
    */
   void Client::resendPackets() {
     while (_resendThreadRunning.load(std::memory_order_acquire)) {
       std::this_thread::sleep_for(
-          std::chrono::milliseconds(RESEND_PACKET_DELAY));
+          std::chrono::milliseconds(RESEND_WHEEL_TICK_MS));
 
       if (!_resendThreadRunning.load(std::memory_order_acquire))
         break;
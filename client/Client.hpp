@@ -21,7 +21,10 @@
 #include "PacketLossMonitor.hpp"
 #include "PacketSender.hpp"
 #include "PacketUtils.hpp"
+#include "RttEstimator.hpp"
 #include "Serializer.hpp"
+#include "TimerWheel.hpp"
+#include "UnacknowledgedRing.hpp"
 
 #define TIMEOUT_MS 100
 
@@ -133,7 +136,9 @@ namespace client {
        *
        * If the connection succeeds, sets the client state to
        * ClientState::IN_CONNECTED_MENU and sends a PlayerInfo packet containing
-       * the current player name and the current outgoing sequence number.
+       * the current player name, the current outgoing sequence number and the
+       * protocol features the client supports (it unpacks bundled
+       * datagrams and decodes compact packets).
        */
       void connect() {
         _networkManager.connect();
@@ -141,7 +146,8 @@ namespace client {
           setClientState(ClientState::IN_CONNECTED_MENU);
 
           PlayerInfoPacket packet = PacketBuilder::makePlayerInfo(
-              getPlayerName(), _sequence_number.load());
+              getPlayerName(), _sequence_number.load(),
+              CAPABILITY_AGGREGATION | CAPABILITY_COMPACT);
           send(packet);
         }
       }
@@ -193,10 +199,8 @@ namespace client {
         }
 
         try {
-          auto serializedData = std::make_shared<std::vector<uint8_t>>(
-              serialization::BitserySerializer::serialize(packet));
-
-          packet::PacketSender::sendPacket(_networkManager, packet);
+          auto serializedData =
+              packet::PacketSender::sendPacket(_networkManager, packet);
           ++_packet_count;
 
           if constexpr (requires { packet.sequence_number; }) {
@@ -350,7 +354,19 @@ namespace client {
         _sequence_number.store(seq, std::memory_order_release);
       }
 
-      void sendInput(std::uint8_t input);
+      /**
+       * @brief Record the movement input currently held by the local player.
+       *
+       * Sampled once per tick by sendInput(); safe to call from the render
+       * thread.
+       *
+       * @param input Bitmask of MovementInputType flags.
+       */
+      void setMovementInput(std::uint8_t input) {
+        _movementInput.store(input, std::memory_order_relaxed);
+      }
+
+      void sendInput();
       void sendShoot(float x, float y);
       void sendMatchmakingRequest();
       void sendRequestChallenge(std::uint32_t room_id);
@@ -409,7 +425,7 @@ namespace client {
         return _challenge;
       }
 
-      void removeAcknowledgedPacket(std::uint32_t sequence_number);
+      void handleAckHeader(const network::AckHeader &header);
 
       void getScoreboard();
       void cleanupGameEntities();
@@ -421,6 +437,21 @@ namespace client {
       void updatePingSeq() {
         _pingSeq++;
       }
+
+      /**
+       * @brief Retrieve the last round-trip time measured with Ping/Pong.
+       *
+       * @return std::uint32_t Round-trip time in milliseconds.
+       */
+      std::uint32_t getLastRtt() const {
+        return _lastRtt.load(std::memory_order_relaxed);
+      }
+
+      void setLastRtt(std::uint32_t rtt) {
+        _lastRtt.store(rtt, std::memory_order_relaxed);
+      }
+
+      void addRttSample(std::chrono::milliseconds sample);
       
       ecs::ECSManager &getEcsManager() {
         return _ecsManager;
@@ -456,8 +487,9 @@ namespace client {
       std::thread _resendThread;
       mutable std::mutex _unacknowledgedPacketsMutex;
       std::atomic<bool> _resendThreadRunning{false};
-      std::unordered_map<std::uint32_t, UnacknowledgedPacket>
-          _unacknowledged_packets;
+      network::UnacknowledgedRing _unacknowledged_packets;
+      network::RttEstimator _rtt;
+      network::TimerWheel<std::uint32_t> _resendWheel;
 
       void registerComponent();
       void registerSystem();
@@ -466,6 +498,11 @@ namespace client {
       void createBackgroundEntities();
 
       uint32_t _pingSeq = 0;
+      std::atomic<std::uint8_t> _movementInput{0};
+      std::array<std::uint8_t, INPUT_REDUNDANCY> _inputHistory{};
+      std::size_t _inputHistoryCount = 0;
+      std::uint32_t _inputTick = 0;
+      std::atomic<std::uint32_t> _lastRtt{0};
       network::PacketLossMonitor _packetLossMonitor;
       mutable std::mutex _packetLossMutex;
 
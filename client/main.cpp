@@ -32,6 +32,10 @@ void gameLoop(client::Client &client) {
   auto lastPing = std::chrono::steady_clock::now();
   const auto pingInterval = std::chrono::milliseconds(PING_INTERVAL_CLIENT);
 
+  auto lastInput = std::chrono::steady_clock::now();
+  const auto inputInterval =
+      std::chrono::milliseconds(INPUT_SEND_INTERVAL_CLIENT);
+
   while (client.isConnected()) {
     client.startReceive();
 
@@ -49,11 +53,17 @@ void gameLoop(client::Client &client) {
               now.time_since_epoch())
               .count());
       PingPacket ping =
-          PacketBuilder::makePing(pingTimestamp, client.getPingSeq());
+          PacketBuilder::makePing(pingTimestamp, client.getPingSeq(),
+                                  client.getLastRtt());
       client.send(ping);
       client.updatePingSeq();
       lastPing = now;
     }
+
+    if (now - lastInput >= inputInterval) {
+      client.sendInput();
+      lastInput += inputInterval;
+    }
   }
 }
 
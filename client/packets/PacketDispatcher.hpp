@@ -0,0 +1,90 @@
+#pragma once
+#include <cstddef>
+#include "IPacket.hpp"
+#include "Packet.hpp"
+#include "PacketHandler.hpp"
+#include "PacketRegistry.hpp"
+
+namespace packet {
+  /**
+   * @brief Signature of a client packet handler entry in the dispatch table.
+   */
+  using PacketHandlerFn = int (*)(client::Client &client, const char *data,
+                                  std::size_t size);
+
+  /**
+   * @brief Run `Handler` on a packet. Handlers are stateless, so the object
+   * lives on the stack and the qualified call is resolved at compile time.
+   */
+  template <typename Handler>
+  int invokeHandler(client::Client &client, const char *data,
+                    std::size_t size) {
+    Handler handler;
+    return handler.Handler::handlePacket(client, data, size);
+  }
+
+  constexpr PacketDispatchTable<PacketHandlerFn> makeClientDispatchTable() {
+    PacketDispatchTable<PacketHandlerFn> table{};
+    bindHandler<PacketType::ChatMessage>(
+        table, &invokeHandler<ChatMessageHandler>);
+    bindHandler<PacketType::EnemySpawn>(table,
+                                        &invokeHandler<EnemySpawnHandler>);
+    bindHandler<PacketType::ProjectileSpawn>(
+        table, &invokeHandler<ProjectileSpawnHandler>);
+    bindHandler<PacketType::ProjectileHit>(
+        table, &invokeHandler<ProjectileHitHandler>);
+    bindHandler<PacketType::ProjectileDestroy>(
+        table, &invokeHandler<ProjectileDestroyHandler>);
+    bindHandler<PacketType::NewPlayer>(table,
+                                       &invokeHandler<NewPlayerHandler>);
+    bindHandler<PacketType::PlayerDeath>(table,
+                                         &invokeHandler<PlayerDeathHandler>);
+    bindHandler<PacketType::PlayerDisconnected>(
+        table, &invokeHandler<PlayerDisconnectedHandler>);
+    bindHandler<PacketType::PlayerMove>(table,
+                                        &invokeHandler<PlayerMoveHandler>);
+    bindHandler<PacketType::EnemyMove>(table,
+                                       &invokeHandler<EnemyMoveHandler>);
+    bindHandler<PacketType::EnemyDeath>(table,
+                                        &invokeHandler<EnemyDeathHandler>);
+    bindHandler<PacketType::GameStart>(table,
+                                       &invokeHandler<GameStartHandler>);
+    bindHandler<PacketType::PlayerShoot>(table,
+                                         &invokeHandler<PlayerShootHandler>);
+    bindHandler<PacketType::JoinRoomResponse>(
+        table, &invokeHandler<JoinRoomResponseHandler>);
+    bindHandler<PacketType::MatchmakingResponse>(
+        table, &invokeHandler<MatchmakingResponseHandler>);
+    bindHandler<PacketType::Pong>(table, &invokeHandler<PongHandler>);
+    bindHandler<PacketType::ChallengeResponse>(
+        table, &invokeHandler<ChallengeResponseHandler>);
+    bindHandler<PacketType::CreateRoomResponse>(
+        table, &invokeHandler<CreateRoomResponseHandler>);
+    bindHandler<PacketType::ScoreboardResponse>(
+        table, &invokeHandler<ScoreboardResponseHandler>);
+    bindHandler<PacketType::GameEnd>(table, &invokeHandler<GameEndHandler>);
+    return table;
+  }
+
+  /**
+   * @brief Routes received packets to their handler through a flat table
+   * indexed by packet type, built at compile time: no allocation, hashing or
+   * virtual call per packet.
+   */
+  class PacketDispatcher {
+    public:
+      /**
+       * @brief Get the handler of a packet type.
+       *
+       * @return PacketHandlerFn The handler, or `nullptr` if the client does
+       * not handle this packet type.
+       */
+      PacketHandlerFn getHandler(PacketType type) const {
+        return _handlers[static_cast<std::uint8_t>(type)];
+      }
+
+    private:
+      static constexpr PacketDispatchTable<PacketHandlerFn> _handlers =
+          makeClientDispatchTable();
+  };
+}  // namespace packet
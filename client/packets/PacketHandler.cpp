@@ -24,33 +24,6 @@
 #include "VelocityComponent.hpp"
 #include "raylib.h"
 
-namespace {
-  /**
-   * @brief Conditionally emits an ACK packet for a processed packet.
-   *
-   * Sends an ACK for the given packet sequence if the packet type requires
-   * acknowledgment and the client has a valid player ID; logs a warning and
-   * does nothing if the player ID is not set.
-   *
-   * @param c Client instance used to obtain the player ID and send the ACK.
-   * @param t Packet type being acknowledged.
-   * @param seq Sequence number of the packet to acknowledge.
-   */
-  inline void sendAckIfNeeded(client::Client &c, PacketType t,
-                              std::uint32_t seq) {
-    if (!shouldAcknowledgePacketType(t))
-      return;
-    auto playerId = c.getPlayerId();
-    if (playerId == INVALID_ID) {
-      TraceLog(LOG_WARNING,
-               "[ACK] Trying to send ACK but player ID is not set yet (seq=%u)",
-               seq);
-      return;
-    }
-    c.send(PacketBuilder::makeAckPacket(seq, playerId));
-  }
-}  // namespace
-
 /**
  * @brief Handle an incoming chat message packet and store it for the specified
  * player.
@@ -63,7 +36,7 @@ namespace {
 int packet::ChatMessageHandler::handlePacket(client::Client &client,
                                              const char *data,
                                              std::size_t size) {
-  serialization::Buffer buffer(data, data + size);
+  auto buffer = serialization::asBytes(data, size);
 
   auto packetOpt =
       serialization::BitserySerializer::deserialize<ChatMessagePacket>(buffer);
@@ -95,7 +68,7 @@ int packet::ChatMessageHandler::handlePacket(client::Client &client,
  */
 int packet::NewPlayerHandler::handlePacket(client::Client &client,
                                            const char *data, std::size_t size) {
-  serialization::Buffer buffer(data, data + size);
+  auto buffer = serialization::asBytes(data, size);
 
   auto packetOpt =
       serialization::BitserySerializer::deserialize<NewPlayerPacket>(buffer);
@@ -133,7 +106,7 @@ int packet::NewPlayerHandler::handlePacket(client::Client &client,
 int packet::PlayerDeathHandler::handlePacket(client::Client &client,
                                              const char *data,
                                              std::size_t size) {
-  serialization::Buffer buffer(data, data + size);
+  auto buffer = serialization::asBytes(data, size);
 
   auto packetOpt =
       serialization::BitserySerializer::deserialize<PlayerDeathPacket>(buffer);
@@ -170,7 +143,7 @@ int packet::PlayerDeathHandler::handlePacket(client::Client &client,
 int packet::PlayerDisconnectedHandler::handlePacket(client::Client &client,
                                                     const char *data,
                                                     std::size_t size) {
-  serialization::Buffer buffer(data, data + size);
+  auto buffer = serialization::asBytes(data, size);
 
   auto packetOpt =
       serialization::BitserySerializer::deserialize<PlayerDisconnectPacket>(
@@ -228,7 +201,7 @@ int packet::PlayerDisconnectedHandler::handlePacket(client::Client &client,
 int packet::PlayerMoveHandler::handlePacket(client::Client &client,
                                             const char *data,
                                             std::size_t size) {
-  serialization::Buffer buffer(data, data + size);
+  auto buffer = serialization::asBytes(data, size);
 
   auto packetOpt =
       serialization::BitserySerializer::deserialize<PlayerMovePacket>(buffer);
@@ -297,7 +270,7 @@ int packet::PlayerMoveHandler::handlePacket(client::Client &client,
 int packet::EnemySpawnHandler::handlePacket(client::Client &client,
                                             const char *data,
                                             std::size_t size) {
-  serialization::Buffer buffer(data, data + size);
+  auto buffer = serialization::asBytes(data, size);
 
   auto packetOpt =
       serialization::BitserySerializer::deserialize<EnemySpawnPacket>(buffer);
@@ -314,7 +287,7 @@ int packet::EnemySpawnHandler::handlePacket(client::Client &client,
 
 int packet::EnemyMoveHandler::handlePacket(client::Client &client,
                                            const char *data, std::size_t size) {
-  serialization::Buffer buffer(data, data + size);
+  auto buffer = serialization::asBytes(data, size);
 
   auto packetOpt =
       serialization::BitserySerializer::deserialize<EnemyMovePacket>(buffer);
@@ -376,7 +349,7 @@ int packet::EnemyMoveHandler::handlePacket(client::Client &client,
 int packet::EnemyDeathHandler::handlePacket(client::Client &client,
                                             const char *data,
                                             std::size_t size) {
-  serialization::Buffer buffer(data, data + size);
+  auto buffer = serialization::asBytes(data, size);
 
   auto packetOpt =
       serialization::BitserySerializer::deserialize<EnemyDeathPacket>(buffer);
@@ -409,7 +382,7 @@ int packet::EnemyDeathHandler::handlePacket(client::Client &client,
 int packet::ProjectileSpawnHandler::handlePacket(client::Client &client,
                                                  const char *data,
                                                  std::size_t size) {
-  serialization::Buffer buffer(data, data + size);
+  auto buffer = serialization::asBytes(data, size);
 
   auto packetOpt =
       serialization::BitserySerializer::deserialize<ProjectileSpawnPacket>(
@@ -498,7 +471,7 @@ int packet::ProjectileSpawnHandler::handlePacket(client::Client &client,
 int packet::ProjectileHitHandler::handlePacket(client::Client &client,
                                                const char *data,
                                                std::size_t size) {
-  serialization::Buffer buffer(data, data + size);
+  auto buffer = serialization::asBytes(data, size);
 
   auto packetOpt =
       serialization::BitserySerializer::deserialize<ProjectileHitPacket>(
@@ -545,7 +518,7 @@ int packet::ProjectileHitHandler::handlePacket(client::Client &client,
 int packet::ProjectileDestroyHandler::handlePacket(client::Client &client,
                                                    const char *data,
                                                    std::size_t size) {
-  serialization::Buffer buffer(data, data + size);
+  auto buffer = serialization::asBytes(data, size);
 
   auto packetOpt =
       serialization::BitserySerializer::deserialize<ProjectileDestroyPacket>(
@@ -587,7 +560,7 @@ int packet::ProjectileDestroyHandler::handlePacket(client::Client &client,
 int packet::JoinRoomResponseHandler::handlePacket(client::Client &client,
                                                   const char *data,
                                                   std::size_t size) {
-  serialization::Buffer buffer(data, data + size);
+  auto buffer = serialization::asBytes(data, size);
 
   auto deserializedPacket =
       serialization::BitserySerializer::deserialize<JoinRoomResponsePacket>(
@@ -628,7 +601,7 @@ int packet::JoinRoomResponseHandler::handlePacket(client::Client &client,
 int packet::MatchmakingResponseHandler::handlePacket(client::Client &client,
                                                      const char *data,
                                                      std::size_t size) {
-  serialization::Buffer buffer(data, data + size);
+  auto buffer = serialization::asBytes(data, size);
 
   auto deserializedPacket =
       serialization::BitserySerializer::deserialize<MatchmakingResponsePacket>(
@@ -657,7 +630,7 @@ int packet::MatchmakingResponseHandler::handlePacket(client::Client &client,
 
 int packet::PongHandler::handlePacket(client::Client &client, const char *data,
                                       std::size_t size) {
-  serialization::Buffer buffer(data, data + size);
+  auto buffer = serialization::asBytes(data, size);
 
   auto packetOpt =
       serialization::BitserySerializer::deserialize<PongPacket>(buffer);
@@ -672,6 +645,8 @@ int packet::PongHandler::handlePacket(client::Client &client, const char *data,
           std::chrono::steady_clock::now().time_since_epoch())
           .count();
   uint32_t ping = currentTimestamp - packet.timestamp;
+  client.setLastRtt(ping);
+  client.addRttSample(std::chrono::milliseconds(ping));
   auto &ecsManager = ecs::ECSManager::getInstance();
   auto playerEntity = client.getPlayerEntity(client.getPlayerId());
   if (playerEntity != INVALID_ENTITY) {
@@ -694,7 +669,7 @@ int packet::PongHandler::handlePacket(client::Client &client, const char *data,
 int packet::ChallengeResponseHandler::handlePacket(client::Client &client,
                                                    const char *data,
                                                    std::size_t size) {
-  serialization::Buffer buffer(data, data + size);
+  auto buffer = serialization::asBytes(data, size);
 
   auto deserializedPacket =
       serialization::BitserySerializer::deserialize<ChallengeResponsePacket>(
@@ -716,7 +691,7 @@ int packet::ChallengeResponseHandler::handlePacket(client::Client &client,
 int packet::CreateRoomResponseHandler::handlePacket(client::Client &client,
                                                     const char *data,
                                                     std::size_t size) {
-  serialization::Buffer buffer(data, data + size);
+  auto buffer = serialization::asBytes(data, size);
 
   auto deserializedPacket =
       serialization::BitserySerializer::deserialize<CreateRoomResponsePacket>(
@@ -741,13 +716,12 @@ int packet::CreateRoomResponseHandler::handlePacket(client::Client &client,
 }
 
 /**
- * @brief Handle a GameStartPacket by entering in-game state and acknowledging
- * it.
+ * @brief Handle a GameStartPacket by entering in-game state.
  *
  * Deserializes a GameStartPacket from the provided buffer; on success sets the
- * client's state to IN_GAME and sends an ACK for the packet.
+ * client's state to IN_GAME.
  *
- * @param client Client instance used to update state and send the ACK.
+ * @param client Client instance whose state is updated.
  * @param data Pointer to the serialized packet data.
  * @param size Number of bytes available at `data`.
  * @return int `packet::OK` on successful processing, `packet::KO` if
@@ -755,7 +729,7 @@ int packet::CreateRoomResponseHandler::handlePacket(client::Client &client,
  */
 int packet::GameStartHandler::handlePacket(client::Client &client,
                                            const char *data, std::size_t size) {
-  serialization::Buffer buffer(data, data + size);
+  auto buffer = serialization::asBytes(data, size);
 
   auto packetOpt =
       serialization::BitserySerializer::deserialize<GameStartPacket>(buffer);
@@ -764,31 +738,28 @@ int packet::GameStartHandler::handlePacket(client::Client &client,
     return packet::KO;
   }
 
-  const GameStartPacket &packet = packetOpt.value();
   TraceLog(LOG_INFO, "[DEBUG] Game is starting!");
 
   client.setClientState(client::ClientState::IN_GAME);
-
-  sendAckIfNeeded(client, packet.header.type, packet.sequence_number);
   return packet::OK;
 }
 
 /**
- * @brief Handle a PlayerShoot packet and acknowledge it if required.
+ * @brief Handle a PlayerShoot packet.
  *
- * Deserializes a PlayerShootPacket from the provided buffer and, on success,
- * sends an ACK using the packet's sequence number and this client's player ID.
+ * Deserializes a PlayerShootPacket from the provided buffer; the packet is
+ * acknowledged by the ack header of the client's next datagram.
  *
- * @param client Client used to obtain the local player ID and to send the ACK.
+ * @param client Client the packet was received by.
  * @param data Pointer to the serialized packet data.
  * @param size Number of bytes available at `data`.
  * @return int `packet::OK` on successful processing, `packet::KO` if
  * deserialization fails.
  */
-int packet::PlayerShootHandler::handlePacket(client::Client &client,
-                                             const char *data,
-                                             std::size_t size) {
-  serialization::Buffer buffer(data, data + size);
+int packet::PlayerShootHandler::handlePacket(
+    [[maybe_unused]] client::Client &client, const char *data,
+    std::size_t size) {
+  auto buffer = serialization::asBytes(data, size);
 
   auto packetOpt =
       serialization::BitserySerializer::deserialize<PlayerShootPacket>(buffer);
@@ -797,40 +768,13 @@ int packet::PlayerShootHandler::handlePacket(client::Client &client,
     return packet::KO;
   }
 
-  const PlayerShootPacket &packet = packetOpt.value();
-  sendAckIfNeeded(client, packet.header.type, packet.sequence_number);
-  return packet::OK;
-}
-
-/**
- * @brief Handle an ACK packet and remove the acknowledged packet from client
- * tracking.
- *
- * Deserializes an AckPacket from the provided buffer and instructs the client
- * to remove the packet identified by the packet's sequence number.
- *
- * @return int `packet::OK` on success, `packet::KO` if deserialization fails.
- */
-int packet::AckPacketHandler::handlePacket(client::Client &client,
-                                           const char *data, std::size_t size) {
-  serialization::Buffer buffer(data, data + size);
-
-  auto packetOpt =
-      serialization::BitserySerializer::deserialize<AckPacket>(buffer);
-  if (!packetOpt) {
-    TraceLog(LOG_ERROR, "[ACK] Failed to deserialize packet");
-    return packet::KO;
-  }
-
-  const AckPacket &packet = packetOpt.value();
-  client.removeAcknowledgedPacket(packet.sequence_number);
   return packet::OK;
 }
 
 int packet::ScoreboardResponseHandler::handlePacket(client::Client &client,
                                                     const char *data,
                                                     std::size_t size) {
-  serialization::Buffer buffer(data, data + size);
+  auto buffer = serialization::asBytes(data, size);
 
   auto deserializedPacket =
       serialization::BitserySerializer::deserialize<ScoreboardResponsePacket>(
@@ -860,7 +804,7 @@ int packet::ScoreboardResponseHandler::handlePacket(client::Client &client,
 
 int packet::GameEndHandler::handlePacket(client::Client &client,
                                          const char *data, std::size_t size) {
-  serialization::Buffer buffer(data, data + size);
+  auto buffer = serialization::asBytes(data, size);
 
   auto deserializedPacket =
       serialization::BitserySerializer::deserialize<GameEndPacket>(buffer);
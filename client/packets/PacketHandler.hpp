@@ -101,12 +101,6 @@ namespace packet {
                        std::size_t size) override;
   };
   
-  class AckPacketHandler : public IPacket {
-    public:
-      int handlePacket(client::Client &client, const char *data,
-                       std::size_t size) override;
-  };
-  
   class ChallengeResponseHandler : public IPacket {
     public:
       int handlePacket(client::Client &client, const char *data,
@@ -6,6 +6,7 @@
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
+#include "Macro.hpp"
 #include "ParamsError.hpp"
 
 /* Macros for files paths */
@@ -16,6 +17,15 @@ constexpr const char *CLIENT_PROPERTIES = "client/client.properties";
 constexpr int MAX_PORT = 65535;
 constexpr int MIN_PORT = 1;
 
+/* Macros for clients */
+constexpr int MAX_CLIENTS = 10000;
+
+/* Macros for datagram aggregation */
+constexpr int MIN_AGGREGATION_MTU = 576;
+
+/* Macros for client send budgets */
+constexpr int MIN_CLIENT_SEND_RATE = 4096;
+
 class Parser {
   public:
     Parser(std::string propertiesPath)
@@ -32,7 +42,7 @@ class Parser {
     std::uint16_t getPort() const {
       return _port;
     }
-    std::uint8_t getMaxClients() const {
+    std::uint16_t getMaxClients() const {
       return _max_clients;
     }
 
@@ -44,12 +54,48 @@ class Parser {
       return _host;
     }
 
+    /**
+     * @brief Directory where room recordings are written; empty when
+     * recording is disabled.
+     */
+    std::string getRecordDirectory() const {
+      return _record_directory;
+    }
+
+    /**
+     * @brief Number of SO_REUSEPORT sockets (and network threads) the server
+     * listens with.
+     */
+    std::uint8_t getNetworkThreads() const {
+      return _network_threads;
+    }
+
+    /**
+     * @brief Size cap of the datagrams bundling several packets for clients
+     * that support it; 0 disables bundling.
+     */
+    std::size_t getAggregationMtu() const {
+      return _aggregation_mtu;
+    }
+
+    /**
+     * @brief Bytes per second sent to each client before its state updates
+     * are deferred; 0 means unlimited.
+     */
+    std::size_t getClientSendRate() const {
+      return _client_send_rate;
+    }
+
   private:
     const std::string _propertiesPath;
     std::uint16_t _port = 4242;
     std::string _host = "127.0.0.1";
-    std::uint8_t _max_clients = 100;
+    std::uint16_t _max_clients = 100;
     std::uint8_t _max_clients_per_room = 4;
+    std::string _record_directory;
+    std::uint8_t _network_threads = 1;
+    std::size_t _aggregation_mtu = AGGREGATION_MTU;
+    std::size_t _client_send_rate = CLIENT_SEND_RATE;
 
     std::unordered_map<std::string, std::function<void(const std::string &)>>
         _propertyParsers = {
@@ -79,7 +125,12 @@ class Parser {
              [this](const std::string &max_clients) {
                if (!max_clients.empty()) {
                  try {
-                   _max_clients = std::stoi(max_clients);
+                   int value = std::stoi(max_clients);
+                   if (value < 1 || value > MAX_CLIENTS) {
+                     throw ParamsError("Max clients must be between 1 and " +
+                                       std::to_string(MAX_CLIENTS) + ".");
+                   }
+                   _max_clients = static_cast<std::uint16_t>(value);
                  } catch (const std::invalid_argument &e) {
                    throw ParamsError(
                        "Invalid max clients in server properties file.");
@@ -111,5 +162,58 @@ class Parser {
                  throw ParamsError(
                      "Invalid clients per room in server properties file.");
                }
+             }},
+            {"RECORD_DIR",
+             [this](const std::string &record_directory) {
+               _record_directory = record_directory;
+             }},
+            {"NETWORK_THREADS",
+             [this](const std::string &network_threads) {
+               try {
+                 int value = std::stoi(network_threads);
+                 if (value < 1 || value > 255) {
+                   throw ParamsError("Network threads must be in [1, 255].");
+                 }
+                 _network_threads = static_cast<std::uint8_t>(value);
+               } catch (const std::invalid_argument &e) {
+                 throw ParamsError(
+                     "Invalid network threads in server properties file.");
+               } catch (const std::out_of_range &e) {
+                 throw ParamsError("Network threads value out of range.");
+               }
+             }},
+            {"AGGREGATION_MTU", [this](const std::string &aggregation_mtu) {
+               try {
+                 int value = std::stoi(aggregation_mtu);
+                 if (value != 0 && (value < MIN_AGGREGATION_MTU ||
+                                    value > static_cast<int>(BUFFER_SIZE))) {
+                   throw ParamsError("Aggregation MTU must be 0 or in [" +
+                                     std::to_string(MIN_AGGREGATION_MTU) +
+                                     ", " + std::to_string(BUFFER_SIZE) +
+                                     "].");
+                 }
+                 _aggregation_mtu = static_cast<std::size_t>(value);
+               } catch (const std::invalid_argument &e) {
+                 throw ParamsError(
+                     "Invalid aggregation MTU in server properties file.");
+               } catch (const std::out_of_range &e) {
+                 throw ParamsError("Aggregation MTU value out of range.");
+               }
+             }},
+            {"CLIENT_SEND_RATE", [this](const std::string &client_send_rate) {
+               try {
+                 int value = std::stoi(client_send_rate);
+                 if (value != 0 && value < MIN_CLIENT_SEND_RATE) {
+                   throw ParamsError("Client send rate must be 0 or at least " +
+                                     std::to_string(MIN_CLIENT_SEND_RATE) +
+                                     " bytes per second.");
+                 }
+                 _client_send_rate = static_cast<std::size_t>(value);
+               } catch (const std::invalid_argument &e) {
+                 throw ParamsError(
+                     "Invalid client send rate in server properties file.");
+               } catch (const std::out_of_range &e) {
+                 throw ParamsError("Client send rate value out of range.");
+               }
              }}};
 };
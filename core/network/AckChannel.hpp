@@ -0,0 +1,253 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include "Macro.hpp"
+
+namespace network {
+
+  /**
+   * @brief Reliability fields written in front of every datagram, in both
+   * directions, so acknowledgements ride along with regular traffic.
+   *
+   * On the wire the header takes ACK_HEADER_SIZE bytes, big-endian:
+   * - 2 bytes: sequence
+   * - 2 bytes: ack
+   * - 4 bytes: ack_bits
+   *
+   * @var sequence Sequence number of this datagram on its connection.
+   * @var ack Most recent sequence number received from the peer.
+   * @var ack_bits Bit `i` is set when sequence `ack - 1 - i` was received
+   * too, so one header acknowledges up to ACK_BITS + 1 datagrams.
+   */
+  struct AckHeader {
+      std::uint16_t sequence = 0;
+      std::uint16_t ack = 0;
+      std::uint32_t ack_bits = 0;
+
+      void write(std::uint8_t *out) const {
+        out[0] = static_cast<std::uint8_t>(sequence >> 8);
+        out[1] = static_cast<std::uint8_t>(sequence & 0xFF);
+        out[2] = static_cast<std::uint8_t>(ack >> 8);
+        out[3] = static_cast<std::uint8_t>(ack & 0xFF);
+        out[4] = static_cast<std::uint8_t>((ack_bits >> 24) & 0xFF);
+        out[5] = static_cast<std::uint8_t>((ack_bits >> 16) & 0xFF);
+        out[6] = static_cast<std::uint8_t>((ack_bits >> 8) & 0xFF);
+        out[7] = static_cast<std::uint8_t>(ack_bits & 0xFF);
+      }
+
+      /**
+       * @brief Parse the header at the start of a received datagram.
+       *
+       * @return true if `size` is large enough to hold a header.
+       */
+      static bool read(const char *data, std::size_t size,
+                       AckHeader &header) {
+        if (size < ACK_HEADER_SIZE)
+          return false;
+        const auto *in = reinterpret_cast<const std::uint8_t *>(data);
+        header.sequence = static_cast<std::uint16_t>((in[0] << 8) | in[1]);
+        header.ack = static_cast<std::uint16_t>((in[2] << 8) | in[3]);
+        header.ack_bits = (static_cast<std::uint32_t>(in[4]) << 24) |
+                          (static_cast<std::uint32_t>(in[5]) << 16) |
+                          (static_cast<std::uint32_t>(in[6]) << 8) |
+                          static_cast<std::uint32_t>(in[7]);
+        return true;
+      }
+
+      /**
+       * @brief Tell whether this header acknowledges the datagram sent with
+       * `sent_sequence`.
+       */
+      bool acknowledges(std::uint16_t sent_sequence) const {
+        const auto distance = static_cast<std::uint16_t>(ack - sent_sequence);
+        if (distance == 0)
+          return true;
+        if (distance > ACK_BITS)
+          return false;
+        return (ack_bits >> (distance - 1)) & 1u;
+      }
+
+      /**
+       * @brief Clear from `pending` the datagrams this header acknowledges,
+       * bit `i` standing for the datagram sent with `last - i`.
+       *
+       * @return std::uint32_t The datagrams still unacknowledged.
+       */
+      std::uint32_t unacknowledged(std::uint16_t last,
+                                   std::uint32_t pending) const {
+        for (std::uint32_t i = 0; i < 32 && (pending >> i) != 0; ++i) {
+          if (((pending >> i) & 1u) &&
+              acknowledges(static_cast<std::uint16_t>(last - i)))
+            pending &= ~(1u << i);
+        }
+        return pending;
+      }
+  };
+
+  /**
+   * @brief Per-connection state of the ack-bitfield reliability layer.
+   *
+   * Numbers outgoing datagrams, keeps the window of sequence numbers
+   * received from the peer that the next header acknowledges, and remembers
+   * which buffers the last ACK_SEND_HISTORY packets sent were, so a reliable
+   * message can be matched to the datagram sequence it went out with. A
+   * datagram bundling several packets records each of them under its
+   * sequence.
+   *
+   * Sends and receives happen on different threads, so every call takes the
+   * channel's mutex; each is a handful of integer operations.
+   */
+  class AckChannel {
+    public:
+      /**
+       * @brief Number the next outgoing datagram and build its header.
+       *
+       * @param buffer Buffer the datagram carries, recorded so findSent()
+       * can map it back to the sequence.
+       * @return AckHeader Header to write in front of the datagram.
+       */
+      AckHeader stamp(const void *buffer) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        const std::uint16_t sequence = _nextSequence++;
+        recordLocked(sequence, buffer);
+        return headerLocked(sequence);
+      }
+
+      /**
+       * @brief Number a datagram that is filled over time (a bundle), before
+       * its packets are recorded with record() and its header is built with
+       * header() when it is sent.
+       *
+       * @param count Number of consecutive datagrams to number, e.g. the
+       * fragments of a packet.
+       * @return std::uint16_t Sequence of the first one.
+       */
+      std::uint16_t reserve(std::uint16_t count = 1) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        const std::uint16_t first = _nextSequence;
+        _nextSequence = static_cast<std::uint16_t>(_nextSequence + count);
+        return first;
+      }
+
+      /**
+       * @brief Remember that `buffer` goes out in the datagram `sequence`.
+       */
+      void record(std::uint16_t sequence, const void *buffer) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        recordLocked(sequence, buffer);
+      }
+
+      /**
+       * @brief Build the header of a datagram numbered with reserve(),
+       * acknowledging what was received up to now.
+       */
+      AckHeader header(std::uint16_t sequence) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return headerLocked(sequence);
+      }
+
+      /**
+       * @brief Record a datagram received from the peer in the window the
+       * next headers acknowledge.
+       */
+      void receive(const AckHeader &header) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_ackPending) {
+          _ackPending = true;
+          _ackPendingSince = std::chrono::steady_clock::now();
+        }
+        if (!_received) {
+          _received = true;
+          _remoteSequence = header.sequence;
+          _remoteBits = 0;
+          return;
+        }
+        const auto ahead =
+            static_cast<std::int16_t>(header.sequence - _remoteSequence);
+        if (ahead > 0) {
+          const auto shift = static_cast<std::uint32_t>(ahead);
+          _remoteBits = shift >= ACK_BITS ? 0 : _remoteBits << shift;
+          if (shift <= ACK_BITS)
+            _remoteBits |= 1u << (shift - 1);
+          _remoteSequence = header.sequence;
+        } else if (ahead < 0 &&
+                   static_cast<std::uint32_t>(-ahead) <= ACK_BITS) {
+          _remoteBits |= 1u << (-ahead - 1);
+        }
+      }
+
+      /**
+       * @brief Sequence of the most recent datagram that carried `buffer`,
+       * if it is still in the send history.
+       */
+      std::optional<std::uint16_t> findSent(const void *buffer) const {
+        std::lock_guard<std::mutex> lock(_mutex);
+        const std::size_t count = std::min(_sentCount, ACK_SEND_HISTORY);
+        for (std::size_t i = 1; i <= count; ++i) {
+          const SentPacket &sent = _sent[(_sentCount - i) % ACK_SEND_HISTORY];
+          if (sent.buffer == buffer)
+            return sent.sequence;
+        }
+        return std::nullopt;
+      }
+
+      /**
+       * @brief Tell whether a datagram was received since the last header
+       * was stamped, i.e. an acknowledgement is still owed to the peer, and
+       * has been for at least `minAge`.
+       */
+      bool hasPendingAck(
+          std::chrono::steady_clock::duration minAge = {}) const {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _ackPending &&
+               std::chrono::steady_clock::now() - _ackPendingSince >= minAge;
+      }
+
+      void reset() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _nextSequence = 1;
+        _remoteSequence = 0;
+        _remoteBits = 0;
+        _received = false;
+        _ackPending = false;
+        _sent = {};
+        _sentCount = 0;
+      }
+
+    private:
+      struct SentPacket {
+          std::uint16_t sequence = 0;
+          const void *buffer = nullptr;
+      };
+
+      void recordLocked(std::uint16_t sequence, const void *buffer) {
+        _sent[_sentCount++ % ACK_SEND_HISTORY] = {sequence, buffer};
+      }
+
+      AckHeader headerLocked(std::uint16_t sequence) {
+        AckHeader header;
+        header.sequence = sequence;
+        header.ack = _remoteSequence;
+        header.ack_bits = _remoteBits;
+        _ackPending = false;
+        return header;
+      }
+
+      mutable std::mutex _mutex;
+      std::uint16_t _nextSequence = 1;
+      std::uint16_t _remoteSequence = 0;
+      std::uint32_t _remoteBits = 0;
+      bool _received = false;
+      bool _ackPending = false;
+      std::chrono::steady_clock::time_point _ackPendingSince;
+      std::array<SentPacket, ACK_SEND_HISTORY> _sent{};
+      std::size_t _sentCount = 0;
+  };
+
+}  // namespace network
@@ -5,6 +5,8 @@
 #include <cstdint>
 #include <functional>
 #include "Macro.hpp"
+#include "PacketCompressor.hpp"
+#include "SendBufferPool.hpp"
 
 namespace network {
 
@@ -36,10 +38,47 @@ namespace network {
         return _io_context;
       }
 
+      /**
+       * @brief Takes an empty, pre-reserved buffer from the manager's send
+       * buffer pool, to serialize an outgoing packet into without allocating.
+       *
+       * @return std::shared_ptr<std::vector<std::uint8_t>> Buffer returned to
+       * the pool once every owner has released it.
+       */
+      std::shared_ptr<std::vector<std::uint8_t>> acquireSendBuffer() {
+        return _sendBuffers.acquire();
+      }
+
     protected:
+      /**
+       * @brief Compress a serialized packet into a buffer taken from `pool`
+       * when its type opts in and compression pays off.
+       *
+       * @param pool Pool the compressed packet's buffer is taken from.
+       * @param buffer Serialized packet.
+       * @return std::shared_ptr<std::vector<std::uint8_t>> The compressed
+       * packet, or `buffer` itself if it is sent uncompressed.
+       */
+      static std::shared_ptr<std::vector<std::uint8_t>> compressForWire(
+          SendBufferPool &pool,
+          const std::shared_ptr<std::vector<std::uint8_t>> &buffer) {
+        if (!compression::Compressor::shouldCompress(*buffer))
+          return buffer;
+        auto compressed = pool.acquire();
+        compressed->resize(
+            compression::Compressor::compressBound(buffer->size()));
+        const std::size_t size =
+            compression::Compressor::compressInto(*buffer, *compressed);
+        if (size == 0)
+          return buffer;
+        compressed->resize(size);
+        return compressed;
+      }
+
       asio::io_context _io_context;
       asio::ip::udp::socket _socket;
       std::array<char, BUFFER_SIZE> _recv_buffer;
+      SendBufferPool _sendBuffers;
   };
 
 }  // namespace network
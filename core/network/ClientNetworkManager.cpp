@@ -4,6 +4,7 @@
 #include <queue>
 #include "Client.hpp"
 #include "Packet.hpp"
+#include "PacketBundle.hpp"
 #include "PacketCompressor.hpp"
 #include "PacketUtils.hpp"
 #include "Serializer.hpp"
@@ -16,7 +17,7 @@ ClientNetworkManager::ClientNetworkManager(const std::string &host,
       _server_endpoint(asio::ip::make_address(host), port),
       _host(host),
       _port(port),
-      _packetFactory(),
+      _packetDispatcher(),
       _timeout(TIMEOUT_MS) {
   _running.store(false, std::memory_order_release);
 }
@@ -37,23 +38,30 @@ void ClientNetworkManager::startReceive(
 }
 
 void ClientNetworkManager::send(const char *data, std::size_t size) {
-  auto buffer = std::make_shared<std::vector<std::uint8_t>>(data, data + size);
-  send(buffer);
+  send(_sendBuffers.acquire(data, size));
 }
 
+/**
+ * @brief Send a serialized packet to the server, compressed when its type
+ * opts in and compression pays off, behind the ack header stamped from the
+ * connection's AckChannel.
+ *
+ * The uncompressed buffer is what the ack history records, so callers can
+ * match it to the datagram's sequence with AckChannel::findSent().
+ */
 void ClientNetworkManager::send(
     std::shared_ptr<std::vector<std::uint8_t>> buffer) {
-  std::shared_ptr<std::vector<std::uint8_t>> data = buffer;
-  if (buffer->size() > COMPRESSION_THRESHOLD) {
-    auto compressed = compression::Compressor::compress(*buffer);
-    if (compression::Compressor::isCompressed(compressed)) {
-      data = std::make_shared<std::vector<std::uint8_t>>(compressed);
-    }
-  }
-
+  std::shared_ptr<std::vector<std::uint8_t>> data =
+      compressForWire(_sendBuffers, buffer);
+
+  auto ackHeader =
+      std::make_shared<std::array<std::uint8_t, ACK_HEADER_SIZE>>();
+  _acks.stamp(buffer.get()).write(ackHeader->data());
+  const std::array<asio::const_buffer, 2> buffers{asio::buffer(*ackHeader),
+                                                  asio::buffer(*data)};
   _socket.async_send_to(
-      asio::buffer(*data), _server_endpoint,
-      [data](const asio::error_code &ec, std::size_t) {
+      buffers, _server_endpoint,
+      [ackHeader, data](const asio::error_code &ec, std::size_t) {
         if (ec) {
           std::cerr << "[WARNING] Send failed: " << ec.message() << std::endl;
         }
@@ -75,6 +83,9 @@ void ClientNetworkManager::connect() {
       _socket.open(_server_endpoint.protocol());
     }
 
+    _acks.reset();
+    _sequences.reset();
+    _fragments.reset();
     _running.store(true, std::memory_order_release);
 
     startAsyncReceive();
@@ -175,29 +186,66 @@ void ClientNetworkManager::processReceivedPackets(client::Client &client) {
 
 void ClientNetworkManager::processPacket(const char *data, std::size_t size,
                                          client::Client &client) {
-  std::vector<std::uint8_t> packetData(
-      reinterpret_cast<const std::uint8_t *>(data),
-      reinterpret_cast<const std::uint8_t *>(data) + size);
+  AckHeader ackHeader;
+  if (!AckHeader::read(data, size, ackHeader)) {
+    std::cerr << "[WARNING] Datagram too small for an ack header, dropping"
+              << std::endl;
+    return;
+  }
+  client.handleAckHeader(ackHeader);
+  if (size == ACK_HEADER_SIZE)
+    return;
+
+  serialization::ByteView payload =
+      serialization::asBytes(data + ACK_HEADER_SIZE, size - ACK_HEADER_SIZE);
+
+  if (PacketFragmenter::isFragment(payload)) {
+    payload = _fragments.add(payload);
+    if (payload.empty())
+      return;
+  }
+  if (!PacketBundle::isBundle(payload)) {
+    dispatchPacket(payload, client);
+    return;
+  }
+  const bool complete = PacketBundle::forEach(
+      payload, [&](serialization::ByteView packet) {
+        dispatchPacket(packet, client);
+      });
+  if (!complete)
+    std::cerr << "[WARNING] Truncated packet bundle, rest dropped"
+              << std::endl;
+}
 
+/**
+ * @brief Decompress or decode one packet of a received datagram if needed and
+ * hand it to the handler registered for its type.
+ */
+void ClientNetworkManager::dispatchPacket(serialization::ByteView packetData,
+                                          client::Client &client) {
   if (compression::Compressor::isCompressed(packetData)) {
-    auto originalSize = packetData.size();
-    auto decompressed = compression::Compressor::decompress(packetData);
-    if (decompressed.size() == originalSize) {
-      std::cerr << "[WARNING] Decompression may have failed, treating as "
-                   "compressed data"
+    packetData = compression::Compressor::decompressToScratch(packetData);
+    if (packetData.empty()) {
+      std::cerr << "[WARNING] Decompression failed, dropping packet"
                 << std::endl;
+      return;
     }
-    packetData = decompressed;
     if (packetData.size() < sizeof(PacketHeader)) {
       std::cerr << "[ERROR] Packet too small after decompression, dropping"
                 << std::endl;
       return;
     }
+  } else if (serialization::CompactCodec::isCompact(packetData)) {
+    packetData =
+        serialization::CompactCodec::decodeToScratch(packetData, _sequences);
+    if (packetData.empty()) {
+      std::cerr << "[WARNING] Invalid compact packet, dropping" << std::endl;
+      return;
+    }
   }
 
-  serialization::Buffer buffer(packetData.begin(), packetData.end());
   auto headerOpt =
-      serialization::BitserySerializer::deserialize<PacketHeader>(buffer);
+      serialization::BitserySerializer::deserialize<PacketHeader>(packetData);
 
   if (!headerOpt) {
     std::cerr << "[WARNING] Failed to deserialize packet header" << std::endl;
@@ -207,11 +255,11 @@ void ClientNetworkManager::processPacket(const char *data, std::size_t size,
   PacketHeader header = headerOpt.value();
   PacketType packet_type = static_cast<PacketType>(header.type);
 
-  auto handler = _packetFactory.createHandler(packet_type);
+  auto handler = _packetDispatcher.getHandler(packet_type);
   if (handler) {
-    int result = handler->handlePacket(
-        client, reinterpret_cast<const char *>(packetData.data()),
-        packetData.size());
+    int result =
+        handler(client, reinterpret_cast<const char *>(packetData.data()),
+                packetData.size());
     if (result != 0) {
       std::cerr << "Error handling packet of type "
                 << packetTypeToString(packet_type) << ": " << result
@@ -1,8 +1,12 @@
 #pragma once
 
 #include <queue>
+#include "AckChannel.hpp"
 #include "BaseNetworkManager.hpp"
-#include "PacketFactory.hpp"
+#include "CompactCodec.hpp"
+#include "PacketDispatcher.hpp"
+#include "PacketFragmenter.hpp"
+#include "Serializer.hpp"
 
 namespace network {
 
@@ -31,6 +35,14 @@ namespace network {
         return _running.load(std::memory_order_acquire);
       }
 
+      /**
+       * @brief Reliability state of the connection to the server, stamped on
+       * every datagram sent.
+       */
+      AckChannel &getAckChannel() {
+        return _acks;
+      }
+
     private:
       std::string _host;
       std::uint16_t _port;
@@ -39,7 +51,10 @@ namespace network {
       asio::ip::udp::endpoint _remote_endpoint;
       std::atomic<bool> _running;
       std::chrono::milliseconds _timeout;
-      packet::PacketHandlerFactory _packetFactory;
+      packet::PacketDispatcher _packetDispatcher;
+      AckChannel _acks;
+      serialization::SequenceExpander _sequences;
+      FragmentReassembler _fragments;
 
       std::queue<ReceivedPacket> _packet_queue;
       std::mutex _mutex;
@@ -49,6 +64,8 @@ namespace network {
       void handleReceive(const asio::error_code &ec, std::size_t length);
       void processPacket(const char *data, std::size_t size,
                          client::Client &client);
+      void dispatchPacket(serialization::ByteView packetData,
+                          client::Client &client);
   };
 
 }  // namespace network
@@ -0,0 +1,199 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include "CompactSerialize.hpp"
+#include "Macro.hpp"
+#include "PacketRegistry.hpp"
+#include "Serializer.hpp"
+
+namespace serialization {
+
+  /**
+   * @brief Receiver side of compact sequence numbers: rebuilds the 32-bit
+   * sequence of a packet that carries only its 16 low bits as the value with
+   * those bits nearest to the latest sequence received.
+   *
+   * The reference only moves forward, so late packets do not drag it back,
+   * except that a full sequence more than 2^15 behind it resynchronizes it,
+   * e.g. when the client moves to another room. One per connection; not
+   * synchronized.
+   */
+  class SequenceExpander {
+    public:
+      /**
+       * @brief Take into account a sequence number received in full.
+       */
+      void observe(std::uint32_t sequence) {
+        const auto ahead = static_cast<std::int32_t>(sequence - _latest);
+        if (ahead > 0 || ahead < -WINDOW)
+          _latest = sequence;
+      }
+
+      /**
+       * @brief Rebuild a sequence number from its 16 low bits.
+       */
+      std::uint32_t expand(std::uint16_t low) {
+        const auto latest = static_cast<std::uint16_t>(_latest);
+        const auto delta = static_cast<std::int16_t>(low - latest);
+        const std::uint32_t sequence =
+            _latest + static_cast<std::uint32_t>(std::int32_t{delta});
+        if (delta > 0)
+          _latest = sequence;
+        return sequence;
+      }
+
+      void reset() {
+        _latest = 0;
+      }
+
+    private:
+      static constexpr std::int32_t WINDOW = 1 << 15;
+
+      std::uint32_t _latest = 0;
+  };
+
+  /**
+   * @brief Signatures of the functions translating one packet type between
+   * its regular encoding and its compact one.
+   */
+  struct CompactCodecEntry {
+      std::size_t (*encode)(ByteView packet, Buffer &out) = nullptr;
+      std::size_t (*decode)(ByteView compact, Buffer &out,
+                            SequenceExpander &sequences) = nullptr;
+  };
+
+  template <PacketType Type>
+  std::size_t encodeCompact(ByteView packet, Buffer &out) {
+    using Packet = typename PacketTraits<Type>::Struct;
+    auto decoded = BitserySerializer::deserialize<Packet>(packet);
+    if (!decoded)
+      return 0;
+    Compact<Packet> compact{*decoded};
+    return BitserySerializer::serializeInto(out, compact);
+  }
+
+  template <PacketType Type>
+  std::size_t decodeCompact(ByteView compact, Buffer &out,
+                            SequenceExpander &sequences) {
+    using Packet = typename PacketTraits<Type>::Struct;
+    Packet packet{};
+    Compact<Packet> view{packet};
+    if (!BitserySerializer::deserializeInto(compact, view))
+      return 0;
+    if constexpr (PacketTraits<Type>::acknowledged)
+      sequences.observe(packet.sequence_number);
+    else
+      packet.sequence_number =
+          sequences.expand(static_cast<std::uint16_t>(packet.sequence_number));
+    packet.header.size =
+        static_cast<std::uint32_t>(BitserySerializer::measure(packet));
+    return BitserySerializer::serializeInto(out, packet);
+  }
+
+  template <PacketType... Types>
+  constexpr PacketDispatchTable<CompactCodecEntry> makeCompactCodecTable(
+      std::integer_sequence<PacketType, Types...>) {
+    PacketDispatchTable<CompactCodecEntry> table{};
+    (
+        [&table] {
+          if constexpr (PacketTraits<Types>::compact)
+            table[compactTag<Types>()] = {&encodeCompact<Types>,
+                                          &decodeCompact<Types>};
+        }(),
+        ...);
+    return table;
+  }
+
+  /**
+   * @brief Codec of every packet type with a compact encoding, indexed by
+   * compact tag byte.
+   */
+  inline constexpr PacketDispatchTable<CompactCodecEntry> COMPACT_CODECS =
+      makeCompactCodecTable(RegisteredPacketTypes{});
+
+  /**
+   * @brief Translates packets between their regular encoding and the compact
+   * one (protocol v2) sent to peers that negotiated CAPABILITY_COMPACT.
+   *
+   * A compact packet starts with a tag byte instead of the PacketHeader:
+   * COMPACT_PACKET_FLAG, COMPACT_FULL_SEQUENCE_FLAG if its sequence number is
+   * sent in full, and its type. Integer fields are varints, zigzag-encoded
+   * when signed, and the size is left to the datagram. Receivers decode
+   * compact packets back to the regular encoding before dispatching them, so
+   * packet handlers only ever see the latter.
+   */
+  class CompactCodec {
+    public:
+      /**
+       * @brief Tell whether received bytes are a compact packet.
+       */
+      static bool isCompact(ByteView bytes) {
+        return !bytes.empty() && (bytes[0] & COMPACT_PACKET_FLAG) != 0 &&
+               bytes[0] != COMPRESSED_PACKET_MARKER;
+      }
+
+      /**
+       * @brief Encode a serialized packet compactly.
+       *
+       * @param packet Packet in the regular encoding.
+       * @param out Destination, replaced.
+       * @return std::size_t Size of the compact packet; 0 if its type has no
+       * compact encoding or the packet is malformed.
+       */
+      static std::size_t encode(ByteView packet, Buffer &out) {
+        if (packet.empty())
+          return 0;
+        const auto type = static_cast<PacketType>(packet[0]);
+        if (!getPacketInfo(type).compact)
+          return 0;
+        const auto &entry = COMPACT_CODECS[compactTagOf(type)];
+        return entry.encode ? entry.encode(packet, out) : 0;
+      }
+
+      /**
+       * @brief Decode a compact packet back to the regular encoding.
+       *
+       * @param sequences Sequence state of the connection it came from.
+       * @return std::size_t Size of the decoded packet; 0 if the bytes are
+       * not a valid compact packet.
+       */
+      static std::size_t decode(ByteView compact, Buffer &out,
+                                SequenceExpander &sequences) {
+        if (!isCompact(compact))
+          return 0;
+        const auto &entry = COMPACT_CODECS[compact[0]];
+        if (!entry.decode) {
+          std::cerr << "[ERROR] Unknown compact packet tag 0x" << std::hex
+                    << static_cast<int>(compact[0]) << std::dec << std::endl;
+          return 0;
+        }
+        return entry.decode(compact, out, sequences);
+      }
+
+      /**
+       * @brief Decode into a per-thread scratch buffer reused across calls,
+       * like compression::Compressor::decompressToScratch().
+       *
+       * @return ByteView The decoded packet, valid until the next call on the
+       * same thread; empty if the bytes are not a valid compact packet.
+       */
+      static ByteView decodeToScratch(ByteView compact,
+                                      SequenceExpander &sequences) {
+        thread_local Buffer scratch;
+        const std::size_t size = decode(compact, scratch, sequences);
+        return {scratch.data(), size};
+      }
+
+    private:
+      static std::uint8_t compactTagOf(PacketType type) {
+        return COMPACT_PACKET_FLAG |
+               (getPacketInfo(type).acknowledged ? COMPACT_FULL_SEQUENCE_FLAG
+                                                 : 0) |
+               static_cast<std::uint8_t>(type);
+      }
+  };
+
+}  // namespace serialization
@@ -0,0 +1,202 @@
+#pragma once
+
+#include <bitsery/ext/compact_value.h>
+#include <cstdint>
+#include "Macro.hpp"
+#include "PacketRegistry.hpp"
+#include "PacketSerialize.hpp"
+
+namespace serialization {
+
+  /**
+   * @brief A packet seen through its compact (protocol v2) encoding, for the
+   * serialize() overloads below; the packet itself keeps its usual layout.
+   *
+   * Only types whose PacketTraits opt in have a compact encoding.
+   */
+  template <typename Packet>
+  struct Compact {
+      Packet &packet;
+  };
+
+  /**
+   * @brief Tag byte starting a compact packet of type `Type`:
+   * COMPACT_PACKET_FLAG, COMPACT_FULL_SEQUENCE_FLAG for acknowledged types
+   * and the packet type in the low bits.
+   */
+  template <PacketType Type>
+  constexpr std::uint8_t compactTag() {
+    static_assert((static_cast<std::uint8_t>(Type) & ~COMPACT_TYPE_MASK) == 0,
+                  "Packet type does not fit in a compact tag byte");
+    return COMPACT_PACKET_FLAG |
+           (PacketTraits<Type>::acknowledged ? COMPACT_FULL_SEQUENCE_FLAG : 0) |
+           static_cast<std::uint8_t>(Type);
+  }
+}  // namespace serialization
+
+/*
+ * Compact helpers
+ */
+template <PacketType Type, typename S>
+/**
+ * @brief Serializes the header of a compact packet: its tag byte alone, the
+ * packet size being the datagram's.
+ */
+void serializeCompactHeader(S &s, PacketHeader &header) {
+  std::uint8_t tag = serialization::compactTag<Type>();
+  s.value1b(tag);
+  header.type = Type;
+}
+
+template <PacketType Type, typename S>
+/**
+ * @brief Serializes a sequence number of a compact packet: in full as a
+ * varint for acknowledged types, whose receivers resynchronize on it, and as
+ * its 16 low bits otherwise, which the receiver puts back in range of the
+ * latest full one (see serialization::SequenceExpander).
+ *
+ * Serializing truncates `sequence` to what was written.
+ */
+void serializeCompactSequence(S &s, std::uint32_t &sequence) {
+  if constexpr (PacketTraits<Type>::acknowledged) {
+    s.ext4b(sequence, bitsery::ext::CompactValue{});
+  } else {
+    auto low = static_cast<std::uint16_t>(sequence);
+    s.value2b(low);
+    sequence = low;
+  }
+}
+
+template <typename S, typename T>
+/**
+ * @brief Serializes an integer as a varint, zigzag-encoded if signed.
+ */
+void serializeCompactValue(S &s, T &value) {
+  s.ext4b(value, bitsery::ext::CompactValue{});
+}
+
+/*
+ * Compact server to client packets
+ */
+template <typename S>
+void serialize(S &s, serialization::Compact<PlayerMovePacket> &compact) {
+  PlayerMovePacket &packet = compact.packet;
+  serializeCompactHeader<PacketType::PlayerMove>(s, packet.header);
+  serializeCompactValue(s, packet.player_id);
+  serializeCompactSequence<PacketType::PlayerMove>(s, packet.sequence_number);
+  s.template value<sizeof(float)>(packet.x);
+  s.template value<sizeof(float)>(packet.y);
+}
+
+template <typename S>
+void serialize(S &s, serialization::Compact<NewPlayerPacket> &compact) {
+  NewPlayerPacket &packet = compact.packet;
+  serializeCompactHeader<PacketType::NewPlayer>(s, packet.header);
+  serializeCompactValue(s, packet.player_id);
+  s.text1b(packet.player_name, SERIALIZE_32_BYTES);
+  s.template value<sizeof(float)>(packet.x);
+  s.template value<sizeof(float)>(packet.y);
+  s.template value<sizeof(float)>(packet.speed);
+  serializeCompactSequence<PacketType::NewPlayer>(s, packet.sequence_number);
+  serializeCompactValue(s, packet.max_health);
+}
+
+template <typename S>
+void serialize(S &s, serialization::Compact<EnemySpawnPacket> &compact) {
+  EnemySpawnPacket &packet = compact.packet;
+  serializeCompactHeader<PacketType::EnemySpawn>(s, packet.header);
+  serializeCompactValue(s, packet.enemy_id);
+  s.value1b(packet.enemy_type);
+  s.template value<sizeof(float)>(packet.x);
+  s.template value<sizeof(float)>(packet.y);
+  s.template value<sizeof(float)>(packet.velocity_x);
+  s.template value<sizeof(float)>(packet.velocity_y);
+  serializeCompactSequence<PacketType::EnemySpawn>(s, packet.sequence_number);
+  serializeCompactValue(s, packet.health);
+  serializeCompactValue(s, packet.max_health);
+}
+
+template <typename S>
+void serialize(S &s, serialization::Compact<EnemyMovePacket> &compact) {
+  EnemyMovePacket &packet = compact.packet;
+  serializeCompactHeader<PacketType::EnemyMove>(s, packet.header);
+  serializeCompactValue(s, packet.enemy_id);
+  s.template value<sizeof(float)>(packet.x);
+  s.template value<sizeof(float)>(packet.y);
+  s.template value<sizeof(float)>(packet.velocity_x);
+  s.template value<sizeof(float)>(packet.velocity_y);
+  serializeCompactSequence<PacketType::EnemyMove>(s, packet.sequence_number);
+}
+
+template <typename S>
+void serialize(S &s, serialization::Compact<EnemyDeathPacket> &compact) {
+  EnemyDeathPacket &packet = compact.packet;
+  serializeCompactHeader<PacketType::EnemyDeath>(s, packet.header);
+  serializeCompactValue(s, packet.enemy_id);
+  s.template value<sizeof(float)>(packet.death_x);
+  s.template value<sizeof(float)>(packet.death_y);
+  serializeCompactValue(s, packet.player_id);
+  serializeCompactValue(s, packet.score);
+  serializeCompactSequence<PacketType::EnemyDeath>(s, packet.sequence_number);
+}
+
+template <typename S>
+void serialize(S &s, serialization::Compact<EnemyHitPacket> &compact) {
+  EnemyHitPacket &packet = compact.packet;
+  serializeCompactHeader<PacketType::EnemyHit>(s, packet.header);
+  serializeCompactValue(s, packet.enemy_id);
+  s.template value<sizeof(float)>(packet.hit_x);
+  s.template value<sizeof(float)>(packet.hit_y);
+  s.template value<sizeof(float)>(packet.damage);
+  serializeCompactSequence<PacketType::EnemyHit>(s, packet.sequence_number);
+}
+
+template <typename S>
+void serialize(S &s, serialization::Compact<ProjectileSpawnPacket> &compact) {
+  ProjectileSpawnPacket &packet = compact.packet;
+  serializeCompactHeader<PacketType::ProjectileSpawn>(s, packet.header);
+  serializeCompactValue(s, packet.projectile_id);
+  s.value1b(packet.projectile_type);
+  serializeCompactValue(s, packet.owner_id);
+  s.value1b(packet.is_enemy_projectile);
+  s.template value<sizeof(float)>(packet.x);
+  s.template value<sizeof(float)>(packet.y);
+  s.template value<sizeof(float)>(packet.velocity_x);
+  s.template value<sizeof(float)>(packet.velocity_y);
+  s.template value<sizeof(float)>(packet.speed);
+  serializeCompactSequence<PacketType::ProjectileSpawn>(
+      s, packet.sequence_number);
+  serializeCompactValue(s, packet.damage);
+}
+
+template <typename S>
+void serialize(S &s, serialization::Compact<ProjectileDestroyPacket> &compact) {
+  ProjectileDestroyPacket &packet = compact.packet;
+  serializeCompactHeader<PacketType::ProjectileDestroy>(s, packet.header);
+  serializeCompactValue(s, packet.projectile_id);
+  s.template value<sizeof(float)>(packet.x);
+  s.template value<sizeof(float)>(packet.y);
+  serializeCompactSequence<PacketType::ProjectileDestroy>(
+      s, packet.sequence_number);
+}
+
+template <typename S>
+void serialize(S &s, serialization::Compact<PlayerHitPacket> &compact) {
+  PlayerHitPacket &packet = compact.packet;
+  serializeCompactHeader<PacketType::PlayerHit>(s, packet.header);
+  serializeCompactValue(s, packet.player_id);
+  s.template value<sizeof(float)>(packet.x);
+  s.template value<sizeof(float)>(packet.y);
+  serializeCompactValue(s, packet.damage);
+  serializeCompactSequence<PacketType::PlayerHit>(s, packet.sequence_number);
+}
+
+template <typename S>
+void serialize(S &s, serialization::Compact<PlayerDeathPacket> &compact) {
+  PlayerDeathPacket &packet = compact.packet;
+  serializeCompactHeader<PacketType::PlayerDeath>(s, packet.header);
+  serializeCompactValue(s, packet.player_id);
+  s.template value<sizeof(float)>(packet.x);
+  s.template value<sizeof(float)>(packet.y);
+  serializeCompactSequence<PacketType::PlayerDeath>(s, packet.sequence_number);
+}
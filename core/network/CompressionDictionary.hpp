@@ -0,0 +1,356 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+// Generated by r_type_lz4_dict train; do not edit.
+
+namespace compression {
+
+  /**
+   * @brief Packets sampled from recorded matches, which prime LZ4 so that
+   * small packets find matches. Client and server must use the same one.
+   */
+  inline constexpr std::array<std::uint8_t, 4079> DICTIONARY = {
+      0x07, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x55, 0x56,
+      0x44, 0x00, 0x00, 0x9c, 0x42, 0x03, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00,
+      0x00, 0x01, 0x00, 0x00, 0x00, 0x12, 0x15, 0x00, 0x00, 0x00, 0x02, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x48, 0x42, 0x00, 0x00, 0x48, 0x42, 0x06, 0x00,
+      0x00, 0x00, 0x01, 0x23, 0x00, 0x00, 0x00, 0xc1, 0xd6, 0xd4, 0x6a, 0xff,
+      0xff, 0xff, 0xff, 0x0d, 0x62, 0x6f, 0x62, 0x20, 0x68, 0x61, 0x73, 0x20,
+      0x64, 0x69, 0x65, 0x64, 0x2e, 0xff, 0x00, 0x00, 0xff, 0x05, 0x00, 0x00,
+      0x00, 0x05, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+      0x80, 0x98, 0x44, 0x00, 0x00, 0x9c, 0x42, 0x00, 0x00, 0xa0, 0xc2, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+      0x00, 0x00, 0x00, 0x0b, 0x15, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+      0x2d, 0x00, 0x52, 0x44, 0x00, 0x00, 0x70, 0x42, 0x00, 0x00, 0x00, 0x00,
+      0x0b, 0x15, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x47, 0xb5, 0xa2,
+      0x44, 0x00, 0x00, 0xc3, 0x42, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x15, 0x00,
+      0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x9c, 0x9a, 0xa2, 0x44, 0x00, 0x00,
+      0xaa, 0x42, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x15, 0x00, 0x00, 0x00, 0x67,
+      0x00, 0x00, 0x00, 0x9c, 0x9a, 0xa2, 0x44, 0x00, 0x00, 0x7a, 0x42, 0x00,
+      0x00, 0x00, 0x00, 0x0b, 0x15, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00,
+      0x47, 0xb5, 0xa2, 0x44, 0x00, 0x00, 0x3e, 0x42, 0x00, 0x00, 0x00, 0x00,
+      0x09, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0x20, 0x41, 0x00,
+      0x00, 0xc8, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x09, 0x2b, 0x00, 0x00, 0x00,
+      0x1f, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x91, 0x42, 0x00, 0x00, 0xc8, 0x42, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00,
+      0x00, 0x00, 0x09, 0x2b, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x01,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x41, 0x00, 0x00, 0x16,
+      0x42, 0x00, 0x00, 0xc8, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x09, 0x2b, 0x00,
+      0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x96, 0x42, 0x00, 0x80, 0x22, 0x43, 0x00, 0x00, 0xc8, 0x42,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x64, 0x00, 0x00, 0x00, 0x09, 0x2b, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00,
+      0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x42, 0x00,
+      0x80, 0x5e, 0x43, 0x00, 0x00, 0xc8, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x09,
+      0x2b, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x48, 0x41, 0x00, 0x00, 0x82, 0x43, 0x00, 0x00,
+      0xc8, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x09, 0x2b, 0x00, 0x00, 0x00, 0xbb,
+      0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+      0x41, 0x00, 0x40, 0x83, 0x43, 0x00, 0x00, 0xc8, 0x42, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+      0x00, 0x09, 0x2b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x01,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xba, 0x43, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0xc8, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x02, 0x15, 0x00, 0x00,
+      0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+      0x41, 0x00, 0x00, 0xb4, 0x41, 0x02, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x41, 0x00, 0x00,
+      0xb4, 0x41, 0x02, 0x15, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0x00, 0x00, 0x02,
+      0x15, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0x48, 0x41, 0x02, 0x15, 0x00, 0x00,
+      0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8,
+      0x41, 0x00, 0x00, 0xc8, 0x41, 0x02, 0x15, 0x00, 0x00, 0x00, 0x02, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x41, 0x00, 0x00,
+      0x16, 0x42, 0x02, 0x15, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+      0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x48, 0x42, 0x00, 0x00, 0x91, 0x42, 0x02, 0x15, 0x00, 0x00,
+      0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8,
+      0x41, 0x00, 0x00, 0x48, 0x42, 0x02, 0x15, 0x00, 0x00, 0x00, 0x02, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x41, 0x00, 0x00,
+      0xaf, 0x42, 0x02, 0x15, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x41, 0x00, 0x00, 0xe1, 0x42, 0x02,
+      0x15, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0xc8, 0x41, 0x00, 0x80, 0x13, 0x43, 0x02, 0x15, 0x00, 0x00,
+      0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8,
+      0x41, 0x00, 0x00, 0xf5, 0x42, 0x02, 0x15, 0x00, 0x00, 0x00, 0x02, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x41, 0x00, 0x00,
+      0xc8, 0x42, 0x02, 0x15, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x42, 0x00, 0x00, 0x70, 0x42, 0x02,
+      0x15, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x42, 0x02, 0x15, 0x00, 0x00,
+      0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96,
+      0x42, 0x00, 0x00, 0xaa, 0x42, 0x02, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x42, 0x00, 0x00,
+      0xf5, 0x42, 0x02, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x42, 0x00, 0x00, 0xf5, 0x42, 0x02,
+      0x15, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x48, 0x42, 0x00, 0x80, 0x09, 0x43, 0x02, 0x15, 0x00, 0x00,
+      0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8,
+      0x42, 0x00, 0x80, 0x13, 0x43, 0x02, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x42, 0x00, 0x00,
+      0x07, 0x43, 0x02, 0x15, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x42, 0x00, 0x80, 0x22, 0x43, 0x02,
+      0x15, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x96, 0x42, 0x00, 0x00, 0x48, 0x42, 0x02, 0x15, 0x00, 0x00,
+      0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96,
+      0x42, 0x00, 0x80, 0x54, 0x43, 0x02, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x09, 0x43, 0x00, 0x00,
+      0x20, 0x43, 0x02, 0x15, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x41, 0x00, 0x00, 0xb4, 0x41, 0x02,
+      0x15, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x48, 0x42, 0x00, 0x00, 0x7a, 0x43, 0x02, 0x15, 0x00, 0x00,
+      0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1,
+      0x42, 0x00, 0x00, 0x52, 0x43, 0x02, 0x15, 0x00, 0x00, 0x00, 0x04, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x41, 0x00, 0x80,
+      0x3b, 0x43, 0x02, 0x15, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x43, 0x02,
+      0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x48, 0x42, 0x00, 0x00, 0x6b, 0x43, 0x02, 0x15, 0x00, 0x00,
+      0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a,
+      0x42, 0x00, 0x00, 0x48, 0x42, 0x02, 0x15, 0x00, 0x00, 0x00, 0x04, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+      0x22, 0x43, 0x02, 0x15, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x41, 0x00, 0x00, 0x2f, 0x43, 0x02,
+      0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x48, 0x41, 0x00, 0x80, 0x8e, 0x43, 0x02, 0x15, 0x00, 0x00,
+      0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x09,
+      0x43, 0x00, 0x00, 0x48, 0x41, 0x02, 0x15, 0x00, 0x00, 0x00, 0x04, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x7a, 0x43, 0x02, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x41, 0x00, 0x80, 0x5e, 0x43, 0x02,
+      0x15, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0xc8, 0x41, 0x00, 0xc0, 0x8f, 0x43, 0x02, 0x15, 0x00, 0x00,
+      0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8,
+      0x42, 0x00, 0x00, 0x16, 0x42, 0x02, 0x15, 0x00, 0x00, 0x00, 0x04, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x41, 0x00, 0x80,
+      0xa2, 0x43, 0x02, 0x15, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x42, 0x00, 0x00, 0x48, 0x42, 0x02,
+      0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0xaa, 0x42, 0x00, 0x00, 0x20, 0x41, 0x02, 0x15, 0x00, 0x00,
+      0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x5e,
+      0x43, 0x00, 0x00, 0x20, 0x41, 0x02, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xa7, 0x43, 0x00, 0x00,
+      0x00, 0x00, 0x02, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x40, 0xec, 0x43, 0x00, 0x00, 0x00, 0x00, 0x02,
+      0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x80, 0x18, 0x44, 0x00, 0x00, 0x00, 0x00, 0x02, 0x15, 0x00, 0x00,
+      0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x37,
+      0x44, 0x00, 0x00, 0x00, 0x00, 0x02, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x5a, 0x44, 0x00, 0x00,
+      0x00, 0x00, 0x02, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x80, 0x7c, 0x44, 0x00, 0x00, 0x00, 0x00, 0x06,
+      0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x98, 0x44,
+      0x00, 0x00, 0x9c, 0x42, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x4b, 0x55, 0x93, 0x44, 0x00, 0x00, 0x9c, 0x42, 0x00, 0x00, 0xa0,
+      0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x55, 0x8e, 0x44, 0x00, 0x00,
+      0x9c, 0x42, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37,
+      0x55, 0x89, 0x44, 0x00, 0x00, 0x9c, 0x42, 0x00, 0x00, 0xa0, 0xc2, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x2d, 0x55, 0x84, 0x44, 0x00, 0x00, 0x9c, 0x42,
+      0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x06, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0xaa, 0x7e,
+      0x44, 0x00, 0x00, 0x9c, 0x42, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x55, 0xaa, 0x74, 0x44, 0x00, 0x00, 0x9c, 0x42, 0x00, 0x00,
+      0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xaa, 0x6a, 0x44, 0x00,
+      0x00, 0x9c, 0x42, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x14, 0x55, 0x60, 0x44, 0x00, 0x00, 0x9c, 0x42, 0x00, 0x00, 0xa0, 0xc2,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x55, 0x56, 0x44, 0x00, 0x00, 0x9c,
+      0x42, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf6, 0x7f,
+      0x93, 0x44, 0x00, 0x00, 0x38, 0x43, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x01,
+      0x00, 0x00, 0x00, 0xec, 0x7f, 0x8e, 0x44, 0x00, 0x00, 0x38, 0x43, 0x00,
+      0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+      0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe2, 0x7f, 0x89, 0x44,
+      0x00, 0x00, 0x38, 0x43, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+      0x00, 0xd8, 0x7f, 0x84, 0x44, 0x00, 0x00, 0x38, 0x43, 0x00, 0x00, 0xa0,
+      0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00,
+      0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa0, 0xff, 0x7e, 0x44, 0x00, 0x00,
+      0x38, 0x43, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xaa,
+      0xff, 0x74, 0x44, 0x00, 0x00, 0x38, 0x43, 0x00, 0x00, 0xa0, 0xc2, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00,
+      0x01, 0x00, 0x00, 0x00, 0x5f, 0xaa, 0x6a, 0x44, 0x00, 0x00, 0x38, 0x43,
+      0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x06, 0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x69, 0xaa, 0x60,
+      0x44, 0x00, 0x00, 0x38, 0x43, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x01, 0x00,
+      0x00, 0x00, 0x73, 0xaa, 0x56, 0x44, 0x00, 0x00, 0x38, 0x43, 0x00, 0x00,
+      0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d,
+      0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x55, 0x55, 0x98, 0x44, 0x00,
+      0x80, 0x0e, 0x44, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0x50, 0xd5, 0x95, 0x44, 0x00, 0x80, 0x0e, 0x44, 0x00, 0x00, 0xa0, 0xc2,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00,
+      0x00, 0x02, 0x00, 0x00, 0x00, 0x4b, 0x55, 0x93, 0x44, 0x00, 0x80, 0x0e,
+      0x44, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x46, 0xd5,
+      0x90, 0x44, 0x00, 0x80, 0x0e, 0x44, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x02,
+      0x00, 0x00, 0x00, 0x41, 0x55, 0x8e, 0x44, 0x00, 0x80, 0x0e, 0x44, 0x00,
+      0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+      0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x96, 0xaa, 0x33, 0x44,
+      0x00, 0x00, 0x38, 0x43, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+      0x00, 0xe1, 0xff, 0x88, 0x44, 0x00, 0x80, 0x0e, 0x44, 0x00, 0x00, 0xa0,
+      0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00,
+      0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xd7, 0xff, 0x83, 0x44, 0x00, 0x80,
+      0x0e, 0x44, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xa1,
+      0xff, 0x7d, 0x44, 0x00, 0x80, 0x0e, 0x44, 0x00, 0x00, 0xa0, 0xc2, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0xab, 0xff, 0x73, 0x44, 0x00, 0x80, 0x0e, 0x44,
+      0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x06, 0x1d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xb5, 0xff, 0x69,
+      0x44, 0x00, 0x80, 0x0e, 0x44, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x02, 0x00,
+      0x00, 0x00, 0xbf, 0xff, 0x5f, 0x44, 0x00, 0x80, 0x0e, 0x44, 0x00, 0x00,
+      0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d,
+      0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xc9, 0xff, 0x55, 0x44, 0x00,
+      0x80, 0x0e, 0x44, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+      0xaa, 0x2a, 0x98, 0x44, 0x00, 0x00, 0x78, 0x43, 0x00, 0x00, 0xa0, 0xc2,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00,
+      0x00, 0x03, 0x00, 0x00, 0x00, 0xa5, 0xaa, 0x95, 0x44, 0x00, 0x00, 0x78,
+      0x43, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xa0, 0x2a,
+      0x93, 0x44, 0x00, 0x00, 0x78, 0x43, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x03,
+      0x00, 0x00, 0x00, 0x9b, 0xaa, 0x90, 0x44, 0x00, 0x00, 0x78, 0x43, 0x00,
+      0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+      0x1d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x96, 0x2a, 0x8e, 0x44,
+      0x00, 0x00, 0x78, 0x43, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+      0x00, 0x91, 0xaa, 0x8b, 0x44, 0x00, 0x00, 0x78, 0x43, 0x00, 0x00, 0xa0,
+      0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00,
+      0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x8c, 0x2a, 0x89, 0x44, 0x00, 0x00,
+      0x78, 0x43, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x87,
+      0xaa, 0x86, 0x44, 0x00, 0x00, 0x78, 0x43, 0x00, 0x00, 0xa0, 0xc2, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0xfb, 0xff, 0x23, 0x44, 0x00, 0x80, 0x0e, 0x44,
+      0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x06, 0x1d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x5a, 0x55, 0x1a,
+      0x44, 0x00, 0x80, 0x0e, 0x44, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x02, 0x00,
+      0x00, 0x00, 0x64, 0x55, 0x10, 0x44, 0x00, 0x80, 0x0e, 0x44, 0x00, 0x00,
+      0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d,
+      0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6e, 0x55, 0x06, 0x44, 0x00,
+      0x80, 0x0e, 0x44, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xe5, 0xaa, 0xf8, 0x43, 0x00, 0x80, 0x0e, 0x44, 0x00, 0x00, 0xa0, 0xc2,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00,
+      0x00, 0x02, 0x00, 0x00, 0x00, 0xdb, 0xaa, 0xe4, 0x43, 0x00, 0x80, 0x0e,
+      0x44, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x55, 0x55,
+      0x98, 0x44, 0x00, 0x80, 0xa5, 0x43, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x02,
+      0x00, 0x00, 0x00, 0xcc, 0xaa, 0xc6, 0x43, 0x00, 0x80, 0x0e, 0x44, 0x00,
+      0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+      0x1d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xc7, 0xaa, 0xbc, 0x43,
+      0x00, 0x80, 0x0e, 0x44, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+      0x00, 0xc2, 0xaa, 0xb2, 0x43, 0x00, 0x80, 0x0e, 0x44, 0x00, 0x00, 0xa0,
+      0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00,
+      0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xbd, 0xaa, 0xa8, 0x43, 0x00, 0x80,
+      0x0e, 0x44, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xb8,
+      0xaa, 0x9e, 0x43, 0x00, 0x80, 0x0e, 0x44, 0x00, 0x00, 0xa0, 0xc2, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0xb3, 0xaa, 0x94, 0x43, 0x00, 0x80, 0x0e, 0x44,
+      0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x06, 0x1d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xae, 0xaa, 0x8a,
+      0x43, 0x00, 0x80, 0x0e, 0x44, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x02, 0x00,
+      0x00, 0x00, 0xa9, 0xaa, 0x80, 0x43, 0x00, 0x80, 0x0e, 0x44, 0x00, 0x00,
+      0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d,
+      0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x7d, 0xaa, 0x81, 0x44, 0x00,
+      0x80, 0xa5, 0x43, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+      0xf6, 0x54, 0x7e, 0x44, 0x00, 0x80, 0xa5, 0x43, 0x00, 0x00, 0xa0, 0xc2,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00,
+      0x00, 0x04, 0x00, 0x00, 0x00, 0xfb, 0x54, 0x79, 0x44, 0x00, 0x80, 0xa5,
+      0x43, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x55,
+      0x74, 0x44, 0x00, 0x80, 0xa5, 0x43, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x04,
+      0x00, 0x00, 0x00, 0x05, 0x55, 0x6f, 0x44, 0x00, 0x80, 0xa5, 0x43, 0x00,
+      0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+      0x1d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0a, 0x55, 0x6a, 0x44,
+      0x00, 0x80, 0xa5, 0x43, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+      0x00, 0x0f, 0x55, 0x65, 0x44, 0x00, 0x80, 0xa5, 0x43, 0x00, 0x00, 0xa0,
+      0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00,
+      0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x14, 0x55, 0x60, 0x44, 0x00, 0x80,
+      0xa5, 0x43, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2d,
+      0x00, 0x98, 0x42, 0x00, 0x80, 0x0e, 0x44, 0x00, 0x00, 0xa0, 0xc2, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x56, 0x00, 0x60, 0x42, 0x00, 0x80, 0x0e, 0x44,
+      0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x06, 0x1d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x10,
+      0x42, 0x00, 0x80, 0x0e, 0x44, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x80, 0x97, 0x44, 0x00, 0x00, 0x1f, 0x43, 0x00, 0x00,
+      0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x88, 0x44, 0x00,
+      0x00, 0x1f, 0x43, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x73, 0x44, 0x00, 0x00, 0x1f, 0x43, 0x00, 0x00, 0xa0, 0xc2,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x44, 0x00, 0x00, 0x1f,
+      0x43, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x42, 0x44, 0x00, 0x00, 0x1f, 0x43, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x01,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x44, 0x00, 0x80, 0xba, 0x43, 0x00,
+      0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+      0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x83, 0x44,
+      0x00, 0x80, 0xba, 0x43, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x78, 0x44, 0x00, 0x80, 0xba, 0x43, 0x00, 0x00, 0xa0,
+      0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00,
+      0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x44, 0x00, 0x80,
+      0xba, 0x43, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x5a, 0x44, 0x00, 0x80, 0xba, 0x43, 0x00, 0x00, 0xa0, 0xc2, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x43, 0x00, 0x00, 0x1f, 0x43,
+      0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x06, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc,
+      0x43, 0x00, 0x00, 0x1f, 0x43, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0xa8, 0x43, 0x00, 0x00, 0x1f, 0x43, 0x00, 0x00,
+      0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d,
+      0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x80, 0x88, 0x44, 0x00,
+      0x00, 0xe6, 0x43, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0x00, 0x80, 0x83, 0x44, 0x00, 0x00, 0xe6, 0x43, 0x00, 0x00, 0xa0, 0xc2,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00,
+      0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x44, 0x00, 0x00, 0xe6,
+      0x43, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x73, 0x44, 0x00, 0x00, 0xe6, 0x43, 0x00, 0x00, 0xa0, 0xc2, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x00, 0x02,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x44, 0x00, 0x00, 0xe6, 0x43, 0x00,
+      0x00, 0xa0, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+
+}  // namespace compression
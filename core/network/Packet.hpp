@@ -39,7 +39,6 @@ enum class PacketType : std::uint8_t {
   CreateRoomResponse = 0x1E,
   Ping = 0x1F,
   Pong = 0x20,
-  Ack = 0x21,
   ScoreboardRequest = 0x22,
   ScoreboardResponse = 0x23
 };
@@ -210,11 +209,15 @@ struct ALIGNED HeartbeatPlayerPacket {
  * UTF-8; truncated to 32 bytes when serialized.
  * @var std::uint32_t PlayerInfoPacket::sequence_number Per-packet ordering
  * index for reliability.
+ * @var std::uint8_t PlayerInfoPacket::capabilities Protocol features the
+ * client supports (CAPABILITY_* flags); the server enables those it
+ * supports too.
  */
 struct ALIGNED PlayerInfoPacket {
     PacketHeader header;
     std::string name;
     std::uint32_t sequence_number;
+    std::uint8_t capabilities;
 };
 
 /**
@@ -657,27 +660,49 @@ struct ALIGNED MatchmakingResponsePacket {
 };
 
 /**
- * @brief Conveys a client's directional input and its client-side sequence
- * number.
+ * @brief Run-length encoded span of identical inputs over consecutive ticks.
  *
- * Contains the packet header, an 8-bit bitfield of MovementInputType flags in
- * `input`, and `sequence_number` for ordering and acknowledgement correlation.
+ * @var input Bitfield of MovementInputType flags held during the run.
+ * @var count Number of consecutive client ticks the input was held for.
+ */
+struct InputRun {
+    std::uint8_t input;
+    std::uint8_t count;
+};
+
+/**
+ * @brief Conveys the last client ticks of directional input.
+ *
+ * Each packet repeats up to INPUT_REDUNDANCY ticks of input, run-length
+ * encoded, so a lost datagram is recovered by the next one. Runs are ordered
+ * from oldest to newest and the last run ends at `last_tick`.
+ *
+ * @var header Common packet header.
+ * @var sequence_number Client-side sequence number.
+ * @var last_tick Client tick of the newest input in the packet.
+ * @var run_count Number of valid entries in `runs` (0 through MAX_INPUT_RUNS).
+ * @var runs Run-length encoded inputs; only the first `run_count` entries are
+ * sent on the wire.
  */
 struct ALIGNED PlayerInputPacket {
     PacketHeader header;
-    std::uint8_t input;
     std::uint32_t sequence_number;
+    std::uint32_t last_tick;
+    std::uint8_t run_count;
+    InputRun runs[MAX_INPUT_RUNS];
 };
 
 /**
  * @brief Ping packet sent from client to server to measure latency.
  *
- * Contains the common packet header and a timestamp representing when the ping was sent.
+ * Contains the common packet header, a timestamp representing when the ping was sent
+ * and the last round-trip time measured by the client, in milliseconds.
  */
 struct ALIGNED PingPacket {
     PacketHeader header;
     std::uint32_t timestamp;
     std::uint32_t sequence_number;
+    std::uint32_t rtt;
 };
 
 /**
@@ -691,24 +716,6 @@ struct ALIGNED PongPacket {
     std::uint32_t sequence_number;
 };
 
-/**
- * @brief Acknowledges receipt of a specific packet sequence number from a
- * player.
- *
- * Contains the common packet header and identifies the acknowledged sequence
- * number along with the player ID associated with that acknowledgement.
- *
- * @var PacketHeader header Common packet header.
- * @var std::uint32_t sequence_number Sequence number being acknowledged.
- * @var std::uint32_t player_id ID of the player associated with the
- * acknowledged packet.
- */
-struct ALIGNED AckPacket {
-    PacketHeader header;
-    std::uint32_t sequence_number;
-    std::uint32_t player_id;
-};
-
 /**
  * @brief Client request to obtain a challenge string for joining a room.
  *
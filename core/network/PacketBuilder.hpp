@@ -21,9 +21,9 @@ struct PacketBuilder {
      * @brief Compute and assign the packet's header.size from its serialized
      * representation.
      *
-     * Serializes a temporary copy of the packet (with header.size cleared) to
-     * determine the full serialized size and, on success, sets
-     * packet.header.size to that value.
+     * The size is measured by walking the packet's fields without encoding
+     * them (header.size itself is a fixed 4-byte field), so the packet is only
+     * encoded once, when it is sent.
      *
      * @tparam P Packet type containing a modifiable `header.size` and
      * `header.type`.
@@ -32,24 +32,11 @@ struct PacketBuilder {
      * @param ctx Short context string included in error messages when sizing
      * fails.
      * @return true if `packet.header.size` was set to the computed serialized
-     * size, `false` if serialization failed or the computed size was outside
-     * valid bounds.
+     * size, `false` if the computed size was outside valid bounds.
      */
     static bool setPayloadSizeFromSerialization(P &packet, const char *ctx) {
-      P temp_packet = packet;
-      temp_packet.header.size = 0;
-
-      serialization::Buffer serializedBuffer =
-          serialization::BitserySerializer::serialize(temp_packet);
-      if (serializedBuffer.empty()) {
-        std::cerr << "[ERROR] Failed to serialize packet (type: "
-                  << packetTypeToString(packet.header.type)
-                  << ") for sizing. Context: " << ctx
-                  << ". Returning empty packet.\n";
-        return false;
-      }
-
-      size_t fullSerializedSize = serializedBuffer.size();
+      size_t fullSerializedSize =
+          serialization::BitserySerializer::measure(packet);
       if (fullSerializedSize < HEADER_SIZE) {
         std::cerr << "[ERROR] Serialized size (" << fullSerializedSize
                   << ") is less than minimum valid packet size (" << HEADER_SIZE
@@ -231,15 +218,19 @@ struct PacketBuilder {
      * @param name Player name to store in the packet; truncated to 32 bytes if
      * necessary.
      * @param sequence_number Sequence number assigned to the packet.
+     * @param capabilities CAPABILITY_* flags of the protocol features the
+     * client supports.
      * @return PlayerInfoPacket Packet with header.type set to
      * PacketType::PlayerInfo and header.size set to the serialized packet size.
      */
     static PlayerInfoPacket makePlayerInfo(const std::string &name,
-                                           std::uint32_t sequence_number) {
+                                           std::uint32_t sequence_number,
+                                           std::uint8_t capabilities = 0) {
       PlayerInfoPacket packet{};
       packet.header.type = PacketType::PlayerInfo;
       packet.name = truncateToBytes(name, 32);
       packet.sequence_number = sequence_number;
+      packet.capabilities = capabilities;
 
       if (!setPayloadSizeFromSerialization(packet, "makePlayerInfo"))
         return {};
@@ -862,52 +853,47 @@ struct PacketBuilder {
     };
 
     /**
-     * @brief Create a PlayerInputPacket representing a player's input state.
+     * @brief Create a PlayerInputPacket carrying the last ticks of input.
      *
-     * The packet's header.type is set to PlayerInput and header.size is
-     * computed from the serialized packet; if size computation fails an empty
-     * packet is returned.
+     * Consecutive identical inputs are run-length encoded. At most
+     * INPUT_REDUNDANCY inputs are kept, the oldest ones being dropped. The
+     * packet's header.type is set to PlayerInput and header.size is computed
+     * from the serialized packet; if size computation fails an empty packet
+     * is returned.
      *
-     * @param input Bitmask of player input flags (buttons/actions).
+     * @param inputs Input bitmasks, one per client tick, oldest first.
+     * @param count Number of entries in `inputs`.
+     * @param last_tick Client tick of the last entry in `inputs`.
      * @param sequence_number Monotonically increasing sequence number for
      * ordering inputs.
-     * @return PlayerInputPacket The populated packet with input flags and
-     * sequence number, or an empty packet on sizing failure.
+     * @return PlayerInputPacket The populated packet with encoded inputs, or
+     * an empty packet on sizing failure.
      */
-    static PlayerInputPacket makePlayerInput(std::uint8_t input,
+    static PlayerInputPacket makePlayerInput(const std::uint8_t *inputs,
+                                             std::size_t count,
+                                             std::uint32_t last_tick,
                                              std::uint32_t sequence_number) {
       PlayerInputPacket packet{};
       packet.header.type = PacketType::PlayerInput;
-      packet.input = input;
       packet.sequence_number = sequence_number;
+      packet.last_tick = last_tick;
+
+      const std::size_t first =
+          count > INPUT_REDUNDANCY ? count - INPUT_REDUNDANCY : 0;
+      for (std::size_t i = first; i < count; ++i) {
+        if (packet.run_count > 0 &&
+            packet.runs[packet.run_count - 1].input == inputs[i]) {
+          packet.runs[packet.run_count - 1].count++;
+          continue;
+        }
+        packet.runs[packet.run_count++] = {inputs[i], 1};
+      }
 
       if (!setPayloadSizeFromSerialization(packet, "makePlayerInput"))
         return {};
       return packet;
     }
 
-    /**
-     * @brief Constructs an acknowledgement packet for a specific sequence and
-     * player.
-     *
-     * @param sequence_number Sequence number being acknowledged.
-     * @param player_id Identifier of the player associated with this
-     * acknowledgement.
-     * @return AckPacket Packet with its header set to `PacketType::Ack`,
-     * `header.size` set, and `sequence_number` and `player_id` populated.
-     */
-    static AckPacket makeAckPacket(uint32_t sequence_number,
-                                   std::uint32_t player_id) {
-      AckPacket packet{};
-      packet.header.type = PacketType::Ack;
-      packet.sequence_number = sequence_number;
-      packet.player_id = player_id;
-
-      if (!setPayloadSizeFromSerialization(packet, "makeAckPacket"))
-        return {};
-      return packet;
-    }
-
     /**
      * @brief Constructs a RequestChallengePacket for a specific room.
      *
@@ -962,14 +948,18 @@ struct PacketBuilder {
      * @brief Constructs a PingPacket with the specified timestamp.
      *
      * @param timestamp Timestamp to include in the ping packet.
+     * @param rtt Last round-trip time measured by the client, in
+     * milliseconds; used by the server for lag compensation.
      * @return PingPacket Packet with header.type set to Ping, header.size set
      * to the packet size, and timestamp set to the provided value.
      */
-    static PingPacket makePing(std::uint32_t timestamp, std::uint32_t sequence_number) {
+    static PingPacket makePing(std::uint32_t timestamp, std::uint32_t sequence_number,
+                               std::uint32_t rtt = 0) {
       PingPacket packet{};
       packet.header.type = PacketType::Ping;
       packet.timestamp = timestamp;
       packet.sequence_number = sequence_number;
+      packet.rtt = rtt;
 
       if (!setPayloadSizeFromSerialization(packet, "makePing"))
         return {};
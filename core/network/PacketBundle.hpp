@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+#include "Macro.hpp"
+
+namespace network {
+
+  /**
+   * @brief Several packets packed into one datagram, to save the IP/UDP
+   * overhead of sending each on its own.
+   *
+   * A bundle follows the ack header in place of a single packet:
+   * - 4 bytes: Magic bytes 'P', 'K', 'B', 0
+   * - then for each packet:
+   *   - 2 bytes: Packet size (big-endian)
+   *   - N bytes: Packet, as it would be sent alone (possibly LZ4 compressed)
+   *
+   * Only sent to peers that advertised CAPABILITY_AGGREGATION.
+   */
+  class PacketBundle {
+    public:
+      /**
+       * @brief Start a bundle in `bundle`, dropping its previous content.
+       */
+      static void begin(std::vector<std::uint8_t> &bundle) {
+        bundle.assign({'P', 'K', 'B', 0});
+      }
+
+      /**
+       * @brief Bytes `packetSize` bytes take once appended to a bundle.
+       */
+      static constexpr std::size_t framedSize(std::size_t packetSize) {
+        return AGGREGATION_LENGTH_SIZE + packetSize;
+      }
+
+      /**
+       * @brief Append a packet to a bundle started with begin(); the caller
+       * checks it fits its datagram budget first.
+       */
+      static void append(std::vector<std::uint8_t> &bundle,
+                         std::span<const std::uint8_t> packet) {
+        bundle.push_back(static_cast<std::uint8_t>(packet.size() >> 8));
+        bundle.push_back(static_cast<std::uint8_t>(packet.size() & 0xFF));
+        bundle.insert(bundle.end(), packet.begin(), packet.end());
+      }
+
+      static bool isBundle(std::span<const std::uint8_t> datagram) {
+        return datagram.size() >= AGGREGATION_HEADER_SIZE &&
+               datagram[0] == 'P' && datagram[1] == 'K' &&
+               datagram[2] == 'B' && datagram[3] == 0;
+      }
+
+      /**
+       * @brief Call `onPacket(std::span<const std::uint8_t>)` for each packet
+       * of a bundle, in order, without copying them.
+       *
+       * @return false if the bundle is truncated; the packets before the
+       * damaged one have been handed out.
+       */
+      template <typename Func>
+      static bool forEach(std::span<const std::uint8_t> bundle,
+                          Func &&onPacket) {
+        std::size_t offset = AGGREGATION_HEADER_SIZE;
+        while (offset < bundle.size()) {
+          if (bundle.size() - offset < AGGREGATION_LENGTH_SIZE)
+            return false;
+          const std::size_t size =
+              (static_cast<std::size_t>(bundle[offset]) << 8) |
+              bundle[offset + 1];
+          offset += AGGREGATION_LENGTH_SIZE;
+          if (size == 0 || bundle.size() - offset < size)
+            return false;
+          onPacket(bundle.subspan(offset, size));
+          offset += size;
+        }
+        return true;
+      }
+  };
+
+}  // namespace network
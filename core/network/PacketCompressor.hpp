@@ -1,162 +1,292 @@
 #pragma once
 
 #include <lz4.h>
+#include <cmath>
 #include <cstdint>
 #include <cstring>
 #include <iostream>
+#include <span>
 #include <vector>
+#include "CompressionDictionary.hpp"
 #include "Macro.hpp"
+#include "PacketUtils.hpp"
 
 namespace compression {
 
   /**
-   * @brief LZ4-based compressor and decompressor for byte buffers.
+   * @brief LZ4-based compressor and decompressor for packets, primed with
+   * the dictionary shipped in CompressionDictionary.hpp.
    *
-   * We use Raw LZ4 compression with a custom header:
-   * - 4 bytes: Magic bytes 'L', 'Z', '4', 0
-   * - 4 bytes: Original uncompressed size (big-endian)
-   * - 4 bytes: Compressed size (big-endian)
-   * - N bytes: Compressed data
+   * Game packets are a few dozen bytes and share most of their structure
+   * (headers, ids, zeroed fields), so on their own they give LZ4 nothing to
+   * match; the dictionary provides it. A compressed packet is:
+   * - 1 byte: COMPRESSED_PACKET_MARKER, which is not a packet type
+   * - 1 to 3 bytes: Original uncompressed size (LEB128 varint)
+   * - N bytes: Raw LZ4 block, up to the end of the packet
    *
-   * The header is 12 bytes total.
+   * Only packet types whose PacketTraits opt in are compressed, and only
+   * when that makes them smaller.
    */
   class Compressor {
     public:
+      /**
+       * @brief Largest compressed packet compressInto() can write for an
+       * input of `size` bytes, header included.
+       */
+      static constexpr std::size_t compressBound(std::size_t size) {
+        return MAX_COMPRESSED_HEADER_SIZE + LZ4_COMPRESSBOUND(size);
+      }
+
       static std::vector<std::uint8_t> compress(
-          const std::vector<std::uint8_t> &input, float ratio = 0.9f) {
+          const std::vector<std::uint8_t> &input, float ratio = 1.0f) {
         if (input.empty()) {
           return {};
         }
 
-        const int srcSize = static_cast<int>(input.size());
-        const int destSize = LZ4_compressBound(srcSize);
-
-        if (destSize <= 0) {
-          std::cerr << "[ERROR] LZ4_compressBound returned invalid size"
-                    << std::endl;
-          throw std::runtime_error("LZ4_compressBound failed");
+        std::vector<std::uint8_t> result(compressBound(input.size()));
+        const std::size_t size = compressInto(input, result, ratio);
+        if (size == 0) {
+          return input;
         }
+        result.resize(size);
+        return result;
+      }
 
-        std::vector<std::uint8_t> compressed;
-        compressed.resize(destSize);
-
-        const int compressedSize = LZ4_compress_default(
-            reinterpret_cast<const char *>(input.data()),
-            reinterpret_cast<char *>(compressed.data()), srcSize, destSize);
-
-        if (compressedSize <= 0) {
-          std::cerr << "[ERROR] LZ4 compression failed!" << std::endl;
-          throw std::runtime_error("LZ4_compress_default failed");
+      /**
+       * @brief Compress a packet into a caller-supplied buffer, without
+       * allocating.
+       *
+       * The dictionary is hashed once per thread, into a stream that every
+       * call starts from a copy of. Compression is abandoned as soon as the
+       * output reaches `ratio` times the input size.
+       *
+       * @param input Serialized packet.
+       * @param output Destination; compressBound(input.size()) bytes always
+       * suffice.
+       * @param ratio Compressed to uncompressed size ratio the result must
+       * stay under.
+       * @return std::size_t Size of the compressed packet written to
+       * `output`, header included; 0 if it would not be smaller than `ratio`
+       * times the input, does not fit in `output`, or the input is empty or
+       * too large.
+       */
+      static std::size_t compressInto(std::span<const std::uint8_t> input,
+                                       std::span<std::uint8_t> output,
+                                       float ratio = 1.0f) {
+        if (input.empty() || input.size() > MAX_DECOMPRESSED_PACKET_SIZE ||
+            output.size() < MAX_COMPRESSED_HEADER_SIZE) {
+          return 0;
         }
 
-        const std::size_t finalSize = HEADER_SIZE_LZ4 + compressedSize;
-
-        const float compressionRatio =
-            static_cast<float>(finalSize) / static_cast<float>(srcSize);
-
-        if (compressionRatio >= ratio) {
-          return input;
+        const double limit = static_cast<double>(ratio) * input.size();
+        std::size_t capacity = output.size();
+        if (limit < static_cast<double>(capacity)) {
+          capacity = limit > 1.0
+                         ? static_cast<std::size_t>(std::ceil(limit)) - 1
+                         : 0;
         }
 
-        std::vector<std::uint8_t> result;
-        result.reserve(finalSize);
-
-        /*
-         * Magic bytes (4)
-         */
-        result.push_back('L');
-        result.push_back('Z');
-        result.push_back('4');
-        result.push_back(0);
+        const std::size_t headerSize = writeHeader(output.data(), input.size());
+        if (capacity <= headerSize) {
+          return 0;
+        }
 
         /*
-         * Original size (4) and Compressed size (4)
+         * Start from a copy of the stream the dictionary was loaded into,
+         * instead of hashing the dictionary again for every packet.
          */
-        result.push_back(static_cast<std::uint8_t>((srcSize >> 24) & 0xFF));
-        result.push_back(static_cast<std::uint8_t>((srcSize >> 16) & 0xFF));
-        result.push_back(static_cast<std::uint8_t>((srcSize >> 8) & 0xFF));
-        result.push_back(static_cast<std::uint8_t>(srcSize & 0xFF));
-
-        result.push_back(
-            static_cast<std::uint8_t>((compressedSize >> 24) & 0xFF));
-        result.push_back(
-            static_cast<std::uint8_t>((compressedSize >> 16) & 0xFF));
-        result.push_back(
-            static_cast<std::uint8_t>((compressedSize >> 8) & 0xFF));
-        result.push_back(static_cast<std::uint8_t>(compressedSize & 0xFF));
-
-        result.insert(result.end(), compressed.begin(),
-                      compressed.begin() + compressedSize);
+        thread_local LZ4_stream_t stream;
+        stream = dictionaryStream();
+        const int compressedSize = LZ4_compress_fast_continue(
+            &stream, reinterpret_cast<const char *>(input.data()),
+            reinterpret_cast<char *>(output.data() + headerSize),
+            static_cast<int>(input.size()),
+            static_cast<int>(capacity - headerSize), 1);
 
-        return result;
+        if (compressedSize <= 0) {
+          return 0;
+        }
+        return headerSize + static_cast<std::size_t>(compressedSize);
       }
 
       static std::vector<std::uint8_t> decompress(
           const std::vector<std::uint8_t> &input) {
-        if (input.empty()) {
-          return input;
-        }
-
         if (!isCompressed(input)) {
           return input;
         }
 
-        if (input.size() < HEADER_SIZE_LZ4) {
-          std::cerr << "[ERROR] Compressed packet too small (size: "
-                    << input.size() << ")" << std::endl;
+        auto decompressed = decompressToScratch(input);
+        if (decompressed.empty()) {
           return input;
         }
+        return {decompressed.begin(), decompressed.end()};
+      }
 
-        /**
-         * We read the original size from the header (bytes 4-7)
-         */
-        std::uint32_t originalSize =
-            (static_cast<std::uint32_t>(input[4]) << 24) |
-            (static_cast<std::uint32_t>(input[5]) << 16) |
-            (static_cast<std::uint32_t>(input[6]) << 8) |
-            static_cast<std::uint32_t>(input[7]);
-
-        std::uint32_t compressedSize = input.size() - HEADER_SIZE_LZ4;
-
-        if (originalSize == 0) {
-          std::cerr << "[ERROR] Invalid original size: " << originalSize
-                    << std::endl;
-          return input;
+      /**
+       * @brief Decompress a packet into a caller-supplied buffer, without
+       * allocating.
+       *
+       * @param input Compressed bytes, header included.
+       * @param output Destination; decompressedSize(input) bytes suffice.
+       * @return std::size_t Size of the decompressed packet written to
+       * `output`; 0 if the input is not a valid compressed packet or does not
+       * fit in `output`.
+       */
+      static std::size_t decompressInto(std::span<const std::uint8_t> input,
+                                        std::span<std::uint8_t> output) {
+        std::size_t originalSize = 0;
+        const std::size_t headerSize = checkHeader(input, originalSize);
+        if (headerSize == 0) {
+          return 0;
         }
-
-        if (compressedSize == 0 || compressedSize > input.size()) {
-          std::cerr << "[ERROR] Invalid compressed size: " << compressedSize
+        if (originalSize > output.size()) {
+          std::cerr << "[ERROR] Decompressed packet of " << originalSize
+                    << " bytes does not fit in " << output.size()
                     << std::endl;
-          return input;
-        }
-
-        if (input.size() < HEADER_SIZE_LZ4 + compressedSize) {
-          std::cerr << "[ERROR] Input size mismatch: got " << input.size()
-                    << " bytes, expected at least "
-                    << (HEADER_SIZE_LZ4 + compressedSize) << std::endl;
-          return input;
+          return 0;
         }
 
-        std::vector<std::uint8_t> decompressed;
-        decompressed.resize(originalSize);
-
-        const int decompressedSize = LZ4_decompress_safe(
-            reinterpret_cast<const char *>(input.data() + HEADER_SIZE_LZ4),
-            reinterpret_cast<char *>(decompressed.data()),
-            static_cast<int>(compressedSize), static_cast<int>(originalSize));
+        const int decompressedSize = LZ4_decompress_safe_usingDict(
+            reinterpret_cast<const char *>(input.data() + headerSize),
+            reinterpret_cast<char *>(output.data()),
+            static_cast<int>(input.size() - headerSize),
+            static_cast<int>(originalSize),
+            reinterpret_cast<const char *>(DICTIONARY.data()),
+            static_cast<int>(DICTIONARY.size()));
 
-        if (decompressedSize < 0) {
+        if (decompressedSize < 0 ||
+            static_cast<std::size_t>(decompressedSize) != originalSize) {
           std::cerr << "[ERROR] LZ4 decompression failed with code: "
                     << decompressedSize << std::endl;
-          return input;
+          return 0;
         }
+        return originalSize;
+      }
 
-        return decompressed;
+      /**
+       * @brief Size a compressed packet decompresses to, as its header
+       * claims.
+       *
+       * @return std::size_t Decompressed size; 0 if the input is not a valid
+       * compressed packet.
+       */
+      static std::size_t decompressedSize(
+          std::span<const std::uint8_t> input) {
+        std::size_t originalSize = 0;
+        return checkHeader(input, originalSize) == 0 ? 0 : originalSize;
+      }
+
+      /**
+       * @brief Decompress into a per-thread scratch buffer reused across
+       * calls, so the receive path does not allocate per datagram.
+       *
+       * @param input Compressed bytes, header included.
+       * @return View of the decompressed bytes, valid until the next call on
+       * the same thread; empty if the input is not a valid compressed packet.
+       */
+      static std::span<const std::uint8_t> decompressToScratch(
+          std::span<const std::uint8_t> input) {
+        thread_local std::vector<std::uint8_t> scratch;
+
+        const std::size_t originalSize = decompressedSize(input);
+        if (originalSize == 0)
+          return {};
+        if (scratch.size() < originalSize)
+          scratch.resize(originalSize);
+        return {scratch.data(), decompressInto(input, scratch)};
       }
 
       static bool isCompressed(const std::vector<std::uint8_t> &buffer) {
-        return buffer.size() >= HEADER_SIZE_LZ4 && buffer[0] == 'L' &&
-               buffer[1] == 'Z' && buffer[2] == '4' && buffer[3] == 0;
+        return isCompressed(std::span<const std::uint8_t>(buffer));
+      }
+
+      static bool isCompressed(std::span<const std::uint8_t> buffer) {
+        return buffer.size() >= 2 && buffer[0] == COMPRESSED_PACKET_MARKER;
+      }
+
+      /**
+       * @brief Tell whether a serialized packet is worth trying to compress:
+       * its type opts in and it is not already compressed.
+       */
+      static bool shouldCompress(std::span<const std::uint8_t> packet) {
+        return packet.size() >= COMPRESSION_MIN_SIZE &&
+               !isCompressed(packet) &&
+               shouldCompressPacketType(static_cast<PacketType>(packet[0]));
+      }
+
+    private:
+      // Largest size a MAX_COMPRESSED_HEADER_SIZE header can hold
+      static constexpr std::size_t MAX_DECOMPRESSED_PACKET_SIZE =
+          (std::size_t{1} << (7 * (MAX_COMPRESSED_HEADER_SIZE - 1))) - 1;
+
+      /**
+       * @brief Stream with the dictionary loaded, built once and copied by
+       * every compression.
+       */
+      static const LZ4_stream_t &dictionaryStream() {
+        static const LZ4_stream_t stream = [] {
+          LZ4_stream_t loaded;
+          LZ4_initStream(&loaded, sizeof(loaded));
+          LZ4_loadDict(&loaded,
+                       reinterpret_cast<const char *>(DICTIONARY.data()),
+                       static_cast<int>(DICTIONARY.size()));
+          return loaded;
+        }();
+        return stream;
+      }
+
+      static std::size_t writeHeader(std::uint8_t *out, std::size_t size) {
+        std::size_t length = 0;
+        out[length++] = COMPRESSED_PACKET_MARKER;
+        do {
+          std::uint8_t byte = size & 0x7F;
+          size >>= 7;
+          if (size != 0)
+            byte |= 0x80;
+          out[length++] = byte;
+        } while (size != 0);
+        return length;
+      }
+
+      /**
+       * @return std::size_t Size of the header, 0 if it is malformed.
+       */
+      static std::size_t readHeader(std::span<const std::uint8_t> input,
+                                    std::size_t &size) {
+        size = 0;
+        for (std::size_t i = 1;
+             i < input.size() && i < MAX_COMPRESSED_HEADER_SIZE; ++i) {
+          size |= static_cast<std::size_t>(input[i] & 0x7F) << (7 * (i - 1));
+          if ((input[i] & 0x80) == 0)
+            return i + 1;
+        }
+        return 0;
+      }
+
+      /**
+       * @brief Read the header of a compressed packet and check that the
+       * sizes it gives are plausible.
+       *
+       * @return std::size_t Size of the header, 0 if the input is not a
+       * valid compressed packet.
+       */
+      static std::size_t checkHeader(std::span<const std::uint8_t> input,
+                                     std::size_t &originalSize) {
+        if (!isCompressed(input))
+          return 0;
+
+        const std::size_t headerSize = readHeader(input, originalSize);
+        const std::size_t compressedSize = input.size() - headerSize;
+
+        // LZ4 cannot expand data more than 255 times, reject bogus sizes
+        // before reserving memory for them
+        if (headerSize == 0 || originalSize == 0 || compressedSize == 0 ||
+            originalSize > compressedSize * 255) {
+          std::cerr << "[ERROR] Invalid compressed packet sizes: "
+                    << originalSize << "/" << compressedSize << std::endl;
+          return 0;
+        }
+        return headerSize;
       }
   };
 
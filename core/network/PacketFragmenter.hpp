@@ -0,0 +1,292 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <span>
+#include <vector>
+#include "Macro.hpp"
+
+namespace network {
+
+  /**
+   * @brief Splitting of a packet too large for one datagram into fragments,
+   * each sent in a datagram of its own, at most FRAGMENT_MTU bytes with its
+   * ack header.
+   *
+   * A fragment follows the ack header in place of a single packet:
+   * - 4 bytes: Magic bytes 'P', 'K', 'F', 0
+   * - 2 bytes: Message id (big-endian), shared by the fragments of a packet
+   * - 1 byte: Index of the fragment
+   * - 1 byte: Number of fragments of the packet
+   * - N bytes: Bytes `index * FRAGMENT_PAYLOAD_SIZE` onwards of the packet,
+   *   FRAGMENT_PAYLOAD_SIZE of them except in the last fragment
+   *
+   * The fragments of a packet go out in consecutive datagrams, so the packet
+   * is tracked by the sequence of the last one and acknowledged once every
+   * one is (see fragmentMask()).
+   */
+  class PacketFragmenter {
+    public:
+      static_assert(MAX_FRAGMENTS <= 32, "One ack mask bit per fragment");
+
+      /**
+       * @brief A fragment parsed by read(), pointing into the datagram.
+       */
+      struct Fragment {
+          std::uint16_t message = 0;
+          std::size_t index = 0;
+          std::size_t count = 0;
+          std::span<const std::uint8_t> payload;
+      };
+
+      /**
+       * @brief Tell whether a packet of `size` bytes has to be fragmented.
+       */
+      static constexpr bool needsFragments(std::size_t size) {
+        return ACK_HEADER_SIZE + size > FRAGMENT_MTU;
+      }
+
+      /**
+       * @brief Number of datagrams a packet of `size` bytes is sent in: 1 if
+       * it fits in one, 0 if it needs more than MAX_FRAGMENTS.
+       */
+      static constexpr std::size_t fragmentCount(std::size_t size) {
+        if (!needsFragments(size))
+          return 1;
+        const std::size_t count =
+            (size + FRAGMENT_PAYLOAD_SIZE - 1) / FRAGMENT_PAYLOAD_SIZE;
+        return count <= MAX_FRAGMENTS ? count : 0;
+      }
+
+      /**
+       * @brief Datagrams that must be acknowledged for a packet of `size`
+       * bytes to be: bit `i` stands for the `i`-th datagram before the last
+       * one that carried it.
+       */
+      static constexpr std::uint32_t fragmentMask(std::size_t size) {
+        const std::size_t count = fragmentCount(size);
+        return allFragments(count == 0 ? MAX_FRAGMENTS : count);
+      }
+
+      /**
+       * @brief Mask with one bit set for each of `count` fragments.
+       */
+      static constexpr std::uint32_t allFragments(std::size_t count) {
+        return count >= 32 ? ~std::uint32_t{0}
+                           : (std::uint32_t{1} << count) - 1;
+      }
+
+      /**
+       * @brief Write fragment `index` of `count` of a packet to `fragment`,
+       * dropping its previous content.
+       */
+      static void write(std::vector<std::uint8_t> &fragment,
+                        std::span<const std::uint8_t> packet,
+                        std::uint16_t message, std::size_t index,
+                        std::size_t count) {
+        const std::size_t offset = index * FRAGMENT_PAYLOAD_SIZE;
+        const std::size_t size =
+            std::min(FRAGMENT_PAYLOAD_SIZE, packet.size() - offset);
+        fragment.assign({'P', 'K', 'F', 0,
+                         static_cast<std::uint8_t>(message >> 8),
+                         static_cast<std::uint8_t>(message & 0xFF),
+                         static_cast<std::uint8_t>(index),
+                         static_cast<std::uint8_t>(count)});
+        fragment.insert(fragment.end(), packet.begin() + offset,
+                        packet.begin() + offset + size);
+      }
+
+      static bool isFragment(std::span<const std::uint8_t> datagram) {
+        return datagram.size() >= FRAGMENT_HEADER_SIZE &&
+               datagram[0] == 'P' && datagram[1] == 'K' &&
+               datagram[2] == 'F' && datagram[3] == 0;
+      }
+
+      /**
+       * @brief Parse a fragment and check that its index, count and size
+       * are consistent.
+       *
+       * @return false if the datagram is not a valid fragment.
+       */
+      static bool read(std::span<const std::uint8_t> datagram,
+                       Fragment &fragment) {
+        if (!isFragment(datagram))
+          return false;
+        fragment.message = static_cast<std::uint16_t>(
+            (datagram[4] << 8) | datagram[5]);
+        fragment.index = datagram[6];
+        fragment.count = datagram[7];
+        fragment.payload = datagram.subspan(FRAGMENT_HEADER_SIZE);
+        if (fragment.count == 0 || fragment.count > MAX_FRAGMENTS ||
+            fragment.index >= fragment.count || fragment.payload.empty() ||
+            fragment.payload.size() > FRAGMENT_PAYLOAD_SIZE)
+          return false;
+        return fragment.index + 1 == fragment.count ||
+               fragment.payload.size() == FRAGMENT_PAYLOAD_SIZE;
+      }
+  };
+
+  /**
+   * @brief Receiver side of PacketFragmenter: collects the fragments of the
+   * packets in flight from one peer and hands each packet out once all of
+   * its fragments arrived.
+   *
+   * Partial packets take room for all their fragments up to `budget` bytes
+   * in total; the oldest are dropped to make room for new ones, and any is
+   * dropped `timeout` after its first fragment arrived. A packet that is
+   * retransmitted is fragmented again under a new message id, so a partial
+   * packet that misses a fragment never completes. Fragments of the last
+   * packets completed, duplicated on the way, are ignored. Not synchronized.
+   */
+  class FragmentReassembler {
+    public:
+      using Clock = std::chrono::steady_clock;
+
+      explicit FragmentReassembler(
+          std::size_t budget = REASSEMBLY_BUDGET,
+          Clock::duration timeout =
+              std::chrono::milliseconds(REASSEMBLY_TIMEOUT_MS))
+          : _budget(budget), _timeout(timeout) {
+      }
+
+      /**
+       * @brief Take in a received fragment.
+       *
+       * @param datagram Fragment, as read by PacketFragmenter::read().
+       * @return std::span<const std::uint8_t> The packet the fragment
+       * completes, valid until the next call; empty otherwise.
+       */
+      std::span<const std::uint8_t> add(std::span<const std::uint8_t> datagram,
+                                        Clock::time_point now = Clock::now()) {
+        PacketFragmenter::Fragment fragment;
+        if (!PacketFragmenter::read(datagram, fragment)) {
+          std::cerr << "[WARNING] Malformed packet fragment, dropping"
+                    << std::endl;
+          return {};
+        }
+        expire(now);
+        if (wasCompleted(fragment.message))
+          return {};
+
+        Partial *partial = find(fragment);
+        if (!partial)
+          partial = start(fragment, now);
+        if (!partial)
+          return {};
+        const std::uint32_t bit = std::uint32_t{1} << fragment.index;
+        if ((partial->missing & bit) == 0)
+          return {};
+        partial->missing &= ~bit;
+        const std::size_t offset = fragment.index * FRAGMENT_PAYLOAD_SIZE;
+        std::memcpy(partial->data.data() + offset, fragment.payload.data(),
+                    fragment.payload.size());
+        if (fragment.index + 1 == fragment.count)
+          partial->size = offset + fragment.payload.size();
+        if (partial->missing != 0)
+          return {};
+
+        _completed[_completedCount++ % _completed.size()] = partial->message;
+        _complete.swap(partial->data);
+        _complete.resize(partial->size);
+        erase(partial - _partials.data());
+        return _complete;
+      }
+
+      /**
+       * @brief Bytes held by partial packets.
+       */
+      std::size_t getSize() const {
+        return _size;
+      }
+
+      void reset() {
+        _partials.clear();
+        _size = 0;
+        _completedCount = 0;
+      }
+
+    private:
+      struct Partial {
+          std::uint16_t message = 0;
+          std::size_t count = 0;
+          std::uint32_t missing = 0;
+          std::size_t size = 0;
+          Clock::time_point started;
+          std::vector<std::uint8_t> data;
+      };
+
+      bool wasCompleted(std::uint16_t message) const {
+        const std::size_t count = std::min(_completedCount, _completed.size());
+        for (std::size_t i = 0; i < count; ++i)
+          if (_completed[i] == message)
+            return true;
+        return false;
+      }
+
+      Partial *find(const PacketFragmenter::Fragment &fragment) {
+        for (std::size_t i = 0; i < _partials.size(); ++i) {
+          if (_partials[i].message != fragment.message)
+            continue;
+          if (_partials[i].count == fragment.count)
+            return &_partials[i];
+          // The id wrapped around onto a stale partial packet
+          erase(i);
+          return nullptr;
+        }
+        return nullptr;
+      }
+
+      Partial *start(const PacketFragmenter::Fragment &fragment,
+                     Clock::time_point now) {
+        const std::size_t size = fragment.count * FRAGMENT_PAYLOAD_SIZE;
+        if (size > _budget) {
+          std::cerr << "[WARNING] Fragmented packet larger than the "
+                       "reassembly budget, dropping"
+                    << std::endl;
+          return nullptr;
+        }
+        while (_size + size > _budget) {
+          std::cerr << "[WARNING] Reassembly budget exceeded, dropping a "
+                       "partial packet"
+                    << std::endl;
+          erase(0);
+        }
+        Partial &partial = _partials.emplace_back();
+        partial.message = fragment.message;
+        partial.count = fragment.count;
+        partial.missing = PacketFragmenter::allFragments(fragment.count);
+        partial.started = now;
+        partial.data.resize(size);
+        _size += size;
+        return &partial;
+      }
+
+      void expire(Clock::time_point now) {
+        for (std::size_t i = 0; i < _partials.size();) {
+          if (now - _partials[i].started > _timeout)
+            erase(i);
+          else
+            ++i;
+        }
+      }
+
+      void erase(std::size_t index) {
+        _size -= _partials[index].count * FRAGMENT_PAYLOAD_SIZE;
+        _partials.erase(_partials.begin() + index);
+      }
+
+      std::size_t _budget;
+      Clock::duration _timeout;
+      std::size_t _size = 0;
+      std::vector<Partial> _partials;
+      std::vector<std::uint8_t> _complete;
+      std::array<std::uint16_t, REASSEMBLY_HISTORY> _completed{};
+      std::size_t _completedCount = 0;
+  };
+
+}  // namespace network
@@ -0,0 +1,334 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+#include "Packet.hpp"
+
+/**
+ * @brief Number of values a PacketType can take on the wire; dispatch and
+ * lookup tables indexed by packet type have this many entries.
+ */
+constexpr std::size_t PACKET_TYPE_COUNT = 256;
+
+/**
+ * @brief Compile-time description of one packet type: the packet struct
+ * (serialized through its `serialize` overload in PacketSerialize.hpp), the
+ * name used in logs, whether the receiver acknowledges it, whether it is
+ * worth compressing (see compression::Compressor) and whether it has a
+ * compact encoding for peers that negotiated CAPABILITY_COMPACT (see
+ * CompactSerialize.hpp).
+ *
+ * Specialized below for every PacketType; using an unregistered type is a
+ * compile error.
+ */
+template <PacketType Type>
+struct PacketTraits;
+
+template <typename Packet, bool Acknowledged, bool Compressed = false,
+          bool Compact = false>
+struct PacketDefinition {
+    using Struct = Packet;
+    static constexpr bool acknowledged = Acknowledged;
+    static constexpr bool compressed = Compressed;
+    static constexpr bool compact = Compact;
+};
+
+template <>
+struct PacketTraits<PacketType::ChatMessage>
+    : PacketDefinition<ChatMessagePacket, true, true> {
+    static constexpr std::string_view name = "ChatMessage";
+};
+
+template <>
+struct PacketTraits<PacketType::PlayerMove>
+    : PacketDefinition<PlayerMovePacket, false, true, true> {
+    static constexpr std::string_view name = "Move";
+};
+
+template <>
+struct PacketTraits<PacketType::NewPlayer>
+    : PacketDefinition<NewPlayerPacket, true, true, true> {
+    static constexpr std::string_view name = "NewPlayer";
+};
+
+template <>
+struct PacketTraits<PacketType::PlayerInfo>
+    : PacketDefinition<PlayerInfoPacket, true> {
+    static constexpr std::string_view name = "PlayerInfo";
+};
+
+template <>
+struct PacketTraits<PacketType::EnemySpawn>
+    : PacketDefinition<EnemySpawnPacket, true, true, true> {
+    static constexpr std::string_view name = "EnemySpawn";
+};
+
+template <>
+struct PacketTraits<PacketType::EnemyMove>
+    : PacketDefinition<EnemyMovePacket, false, true, true> {
+    static constexpr std::string_view name = "EnemyMove";
+};
+
+template <>
+struct PacketTraits<PacketType::EnemyDeath>
+    : PacketDefinition<EnemyDeathPacket, true, true, true> {
+    static constexpr std::string_view name = "EnemyDeath";
+};
+
+template <>
+struct PacketTraits<PacketType::PlayerShoot>
+    : PacketDefinition<PlayerShootPacket, true> {
+    static constexpr std::string_view name = "PlayerShoot";
+};
+
+template <>
+struct PacketTraits<PacketType::ProjectileSpawn>
+    : PacketDefinition<ProjectileSpawnPacket, true, true, true> {
+    static constexpr std::string_view name = "ProjectileSpawn";
+};
+
+template <>
+struct PacketTraits<PacketType::ProjectileHit>
+    : PacketDefinition<ProjectileHitPacket, false> {
+    static constexpr std::string_view name = "ProjectileHit";
+};
+
+template <>
+struct PacketTraits<PacketType::ProjectileDestroy>
+    : PacketDefinition<ProjectileDestroyPacket, true, true, true> {
+    static constexpr std::string_view name = "ProjectileDestroy";
+};
+
+template <>
+struct PacketTraits<PacketType::GameStart>
+    : PacketDefinition<GameStartPacket, true> {
+    static constexpr std::string_view name = "GameStart";
+};
+
+template <>
+struct PacketTraits<PacketType::GameEnd>
+    : PacketDefinition<GameEndPacket, true> {
+    static constexpr std::string_view name = "GameEnd";
+};
+
+template <>
+struct PacketTraits<PacketType::PlayerDisconnected>
+    : PacketDefinition<PlayerDisconnectPacket, true> {
+    static constexpr std::string_view name = "PlayerDisconnected";
+};
+
+template <>
+struct PacketTraits<PacketType::Heartbeat>
+    : PacketDefinition<HeartbeatPlayerPacket, false> {
+    static constexpr std::string_view name = "Heartbeat";
+};
+
+template <>
+struct PacketTraits<PacketType::EnemyHit>
+    : PacketDefinition<EnemyHitPacket, true, true, true> {
+    static constexpr std::string_view name = "EnemyHit";
+};
+
+template <>
+struct PacketTraits<PacketType::PlayerHit>
+    : PacketDefinition<PlayerHitPacket, true, true, true> {
+    static constexpr std::string_view name = "PlayerHit";
+};
+
+template <>
+struct PacketTraits<PacketType::PlayerDeath>
+    : PacketDefinition<PlayerDeathPacket, true, true, true> {
+    static constexpr std::string_view name = "PlayerDeath";
+};
+
+template <>
+struct PacketTraits<PacketType::CreateRoom>
+    : PacketDefinition<CreateRoomPacket, true> {
+    static constexpr std::string_view name = "CreateRoom";
+};
+
+template <>
+struct PacketTraits<PacketType::JoinRoom>
+    : PacketDefinition<JoinRoomPacket, true> {
+    static constexpr std::string_view name = "JoinRoom";
+};
+
+template <>
+struct PacketTraits<PacketType::LeaveRoom>
+    : PacketDefinition<LeaveRoomPacket, false> {
+    static constexpr std::string_view name = "LeaveRoom";
+};
+
+template <>
+struct PacketTraits<PacketType::ListRoom>
+    : PacketDefinition<ListRoomPacket, false> {
+    static constexpr std::string_view name = "ListRoom";
+};
+
+template <>
+struct PacketTraits<PacketType::ListRoomResponse>
+    : PacketDefinition<ListRoomResponsePacket, false, true> {
+    static constexpr std::string_view name = "ListRoomResponse";
+};
+
+template <>
+struct PacketTraits<PacketType::MatchmakingRequest>
+    : PacketDefinition<MatchmakingRequestPacket, true> {
+    static constexpr std::string_view name = "MatchmakingRequest";
+};
+
+template <>
+struct PacketTraits<PacketType::MatchmakingResponse>
+    : PacketDefinition<MatchmakingResponsePacket, true> {
+    static constexpr std::string_view name = "MatchmakingResponse";
+};
+
+template <>
+struct PacketTraits<PacketType::JoinRoomResponse>
+    : PacketDefinition<JoinRoomResponsePacket, true> {
+    static constexpr std::string_view name = "JoinRoomResponse";
+};
+
+template <>
+struct PacketTraits<PacketType::PlayerInput>
+    : PacketDefinition<PlayerInputPacket, false> {
+    static constexpr std::string_view name = "PlayerInput";
+};
+
+template <>
+struct PacketTraits<PacketType::RequestChallenge>
+    : PacketDefinition<RequestChallengePacket, true> {
+    static constexpr std::string_view name = "RequestChallenge";
+};
+
+template <>
+struct PacketTraits<PacketType::ChallengeResponse>
+    : PacketDefinition<ChallengeResponsePacket, false> {
+    static constexpr std::string_view name = "ChallengeResponse";
+};
+
+template <>
+struct PacketTraits<PacketType::CreateRoomResponse>
+    : PacketDefinition<CreateRoomResponsePacket, true> {
+    static constexpr std::string_view name = "CreateRoomResponse";
+};
+
+template <>
+struct PacketTraits<PacketType::Ping>
+    : PacketDefinition<PingPacket, false> {
+    static constexpr std::string_view name = "Ping";
+};
+
+template <>
+struct PacketTraits<PacketType::Pong>
+    : PacketDefinition<PongPacket, false> {
+    static constexpr std::string_view name = "Pong";
+};
+
+template <>
+struct PacketTraits<PacketType::ScoreboardRequest>
+    : PacketDefinition<ScoreboardRequestPacket, false> {
+    static constexpr std::string_view name = "ScoreboardRequest";
+};
+
+template <>
+struct PacketTraits<PacketType::ScoreboardResponse>
+    : PacketDefinition<ScoreboardResponsePacket, false, true> {
+    static constexpr std::string_view name = "ScoreboardResponse";
+};
+
+/**
+ * @brief Every registered packet type, in wire order.
+ */
+using RegisteredPacketTypes = std::integer_sequence<
+    PacketType,
+    PacketType::ChatMessage,
+    PacketType::PlayerMove,
+    PacketType::NewPlayer,
+    PacketType::PlayerInfo,
+    PacketType::EnemySpawn,
+    PacketType::EnemyMove,
+    PacketType::EnemyDeath,
+    PacketType::PlayerShoot,
+    PacketType::ProjectileSpawn,
+    PacketType::ProjectileHit,
+    PacketType::ProjectileDestroy,
+    PacketType::GameStart,
+    PacketType::GameEnd,
+    PacketType::PlayerDisconnected,
+    PacketType::Heartbeat,
+    PacketType::EnemyHit,
+    PacketType::PlayerHit,
+    PacketType::PlayerDeath,
+    PacketType::CreateRoom,
+    PacketType::JoinRoom,
+    PacketType::LeaveRoom,
+    PacketType::ListRoom,
+    PacketType::ListRoomResponse,
+    PacketType::MatchmakingRequest,
+    PacketType::MatchmakingResponse,
+    PacketType::JoinRoomResponse,
+    PacketType::PlayerInput,
+    PacketType::RequestChallenge,
+    PacketType::ChallengeResponse,
+    PacketType::CreateRoomResponse,
+    PacketType::Ping,
+    PacketType::Pong,
+    PacketType::ScoreboardRequest,
+    PacketType::ScoreboardResponse>;
+
+/**
+ * @brief Runtime view of a PacketTraits entry, stored in PACKET_INFO.
+ */
+struct PacketInfo {
+    std::string_view name;
+    bool acknowledged = false;
+    bool compressed = false;
+    bool compact = false;
+    bool registered = false;
+};
+
+template <PacketType... Types>
+constexpr std::array<PacketInfo, PACKET_TYPE_COUNT> makePacketInfoTable(
+    std::integer_sequence<PacketType, Types...>) {
+  std::array<PacketInfo, PACKET_TYPE_COUNT> table{};
+  ((table[static_cast<std::uint8_t>(Types)] = {
+        PacketTraits<Types>::name, PacketTraits<Types>::acknowledged,
+        PacketTraits<Types>::compressed, PacketTraits<Types>::compact, true}),
+   ...);
+  return table;
+}
+
+/**
+ * @brief Flat table of PacketInfo indexed by the raw packet type byte;
+ * entries of unregistered values have `registered` set to false.
+ */
+inline constexpr std::array<PacketInfo, PACKET_TYPE_COUNT> PACKET_INFO =
+    makePacketInfoTable(RegisteredPacketTypes{});
+
+constexpr const PacketInfo &getPacketInfo(PacketType type) {
+  return PACKET_INFO[static_cast<std::uint8_t>(type)];
+}
+
+/**
+ * @brief Flat table of packet handlers indexed by the raw packet type byte,
+ * filled at compile time with bindHandler(). Empty entries are `nullptr`.
+ *
+ * @tparam Handler Function pointer type of the handlers.
+ */
+template <typename Handler>
+using PacketDispatchTable = std::array<Handler, PACKET_TYPE_COUNT>;
+
+/**
+ * @brief Bind `handler` to packet type `Type` in `table`; fails to compile if
+ * `Type` is not registered.
+ */
+template <PacketType Type, typename Handler>
+constexpr void bindHandler(PacketDispatchTable<Handler> &table,
+                           Handler handler) {
+  static_assert(!PacketTraits<Type>::name.empty());
+  table[static_cast<std::uint8_t>(Type)] = handler;
+}
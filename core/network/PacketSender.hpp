@@ -9,17 +9,21 @@ namespace packet {
 
   class PacketSender {
     public:
+      /**
+       * @brief Serialize a packet into a pooled send buffer and send it.
+       *
+       * Compression is left to the network manager's send().
+       *
+       * @return std::shared_ptr<std::vector<std::uint8_t>> The serialized
+       * packet, for callers that keep it for retransmission.
+       */
       template <typename T>
-      static void sendPacket(network::BaseNetworkManager &networkManager,
-                             const T &packet) {
-        auto serialized = serialization::BitserySerializer::serialize(packet);
-
-        if (serialized.size() > COMPRESSION_THRESHOLD) {
-          serialized = compression::Compressor::compress(serialized);
-        }
-
-        auto buffer = std::make_shared<std::vector<std::uint8_t>>(serialized);
+      static std::shared_ptr<std::vector<std::uint8_t>> sendPacket(
+          network::BaseNetworkManager &networkManager, const T &packet) {
+        auto buffer = networkManager.acquireSendBuffer();
+        serialization::BitserySerializer::serializeInto(*buffer, packet);
         networkManager.send(buffer);
+        return buffer;
       }
   };
 }  // namespace packet
@@ -5,14 +5,51 @@
 #include <bitsery/traits/string.h>
 #include <bitsery/traits/vector.h>
 #include <algorithm>
+#include <cstddef>
+#include <span>
 #include <vector>
 #include "Macro.hpp"
 #include "Packet.hpp"
 
 namespace serialization {
   using Buffer = std::vector<std::uint8_t>;
+  /**
+   * @brief Read-only view over serialized bytes, e.g. a receive buffer;
+   * deserializing from it does not copy the bytes.
+   */
+  using ByteView = std::span<const std::uint8_t>;
+}  // namespace serialization
+
+namespace bitsery::traits {
+  template <>
+  struct ContainerTraits<serialization::ByteView> {
+      using TValue = std::uint8_t;
+      static constexpr bool isResizable = false;
+      static constexpr bool isContiguous = true;
+
+      static std::size_t size(const serialization::ByteView &view) {
+        return view.size();
+      }
+  };
+
+  template <>
+  struct BufferAdapterTraits<serialization::ByteView> {
+      using TIterator = const std::uint8_t *;
+      using TConstIterator = const std::uint8_t *;
+      using TValue = std::uint8_t;
+  };
+}  // namespace bitsery::traits
+
+namespace serialization {
   using OutputAdapter = bitsery::OutputBufferAdapter<Buffer>;
-  using InputAdapter = bitsery::InputBufferAdapter<Buffer>;
+  using InputAdapter = bitsery::InputBufferAdapter<ByteView>;
+
+  /**
+   * @brief View the `size` bytes at `data` without copying them.
+   */
+  inline ByteView asBytes(const char *data, std::size_t size) {
+    return {reinterpret_cast<const std::uint8_t *>(data), size};
+  }
 }  // namespace serialization
 
 /*
@@ -63,16 +100,18 @@ template <typename S>
  * @brief Serializes a PlayerInfoPacket into the provided serializer.
  *
  * Writes the packet header fields, the player's name as exactly 32 bytes,
- * and the packet's sequence_number.
+ * the packet's sequence_number and the client's capability flags.
  *
- * @param packet The PlayerInfoPacket whose header, 32-byte name array, and
- *               sequence_number will be written to the serializer.
+ * @param packet The PlayerInfoPacket whose header, 32-byte name array,
+ *               sequence_number and capabilities will be written to the
+ *               serializer.
  */
 void serialize(S &s, PlayerInfoPacket &packet) {
   s.value1b(packet.header.type);
   s.value4b(packet.header.size);
   s.text1b(packet.name, SERIALIZE_32_BYTES);
   s.value4b(packet.sequence_number);
+  s.value1b(packet.capabilities);
 }
 
 template <typename S>
@@ -540,27 +579,44 @@ void serialize(S &s, MatchmakingResponsePacket &packet) {
   s.value4b(packet.sequence_number);
 }
 
+template <typename S>
+/**
+ * @brief Serializes an InputRun as its input byte followed by its count.
+ *
+ * @param run InputRun to serialize.
+ */
+void serialize(S &s, InputRun &run) {
+  s.value1b(run.input);
+  s.value1b(run.count);
+}
+
 template <typename S>
 /**
  * @brief Serializes a PlayerInputPacket into the provided archive.
  *
- * Writes the header fields (type, size), the input byte, and the packet's
- * sequence_number in that order.
+ * Writes the header fields (type, size), the sequence_number, the last_tick,
+ * the run count, then only the first `run_count` runs (capped at
+ * MAX_INPUT_RUNS).
  *
  * @param packet Packet to serialize.
  */
 void serialize(S &s, PlayerInputPacket &packet) {
   s.value1b(packet.header.type);
   s.value4b(packet.header.size);
-  s.value1b(packet.input);
   s.value4b(packet.sequence_number);
+  s.value4b(packet.last_tick);
+  s.value1b(packet.run_count);
+  for (std::size_t i = 0; i < packet.run_count && i < MAX_INPUT_RUNS; ++i) {
+    serialize(s, packet.runs[i]);
+  }
 }
 
 template<typename S>
 /**
  * @brief Serializes a PingPacket into the provided serializer.
  *
- * Writes the packet header (type and size) followed by the timestamp.
+ * Writes the packet header (type and size) followed by the timestamp, the
+ * sequence number and the last measured round-trip time.
  *
  * @param s Serializer to write into.
  * @param packet PingPacket to serialize.
@@ -570,6 +626,7 @@ void serialize(S& s, PingPacket& packet) {
   s.value4b(packet.header.size);
   s.value4b(packet.timestamp);
   s.value4b(packet.sequence_number);
+  s.value4b(packet.rtt);
 }
 
 template<typename S>
@@ -585,23 +642,6 @@ void serialize(S& s, PongPacket& packet) {
   s.value4b(packet.timestamp);
   s.value4b(packet.sequence_number);
 }
-template <typename S>
-/**
- * @brief Serialize an AckPacket into the serializer.
- *
- * Writes the packet fields in order: header.type (1 byte), header.size (4
- * bytes), sequence_number (4 bytes), and player_id (4 bytes).
- *
- * @param s Serializer adapter to write data into.
- * @param packet AckPacket to serialize.
- */
-void serialize(S &s, AckPacket &packet) {
-  s.value1b(packet.header.type);
-  s.value4b(packet.header.size);
-  s.value4b(packet.sequence_number);
-  s.value4b(packet.player_id);
-}
-
 template <typename S>
 /**
  * @brief Serializes a RequestChallengePacket into the serializer.
@@ -692,7 +732,7 @@ void serialize(S &s, ScoreboardResponsePacket &packet) {
   s.value4b(packet.header.size);
   s.value4b(packet.entry_count);
 
-  packet.entry_count = std::min(packet.entry_count, SCOREBOARD_MAX_ENTRIES);
+  packet.entry_count = std::min(packet.entry_count, MAX_TOP_SCORES);
 
   s.container(packet.scores, packet.entry_count,
               [](S &s, ScoreEntry &entry) { serialize(s, entry); });
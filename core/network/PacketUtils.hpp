@@ -2,10 +2,12 @@
 
 #include <chrono>
 #include <memory>
+#include <optional>
 #include <sstream>
 #include <string>
 #include <vector>
 #include "Packet.hpp"
+#include "PacketRegistry.hpp"
 
 /**
  * @brief Convert a PacketType value to a human-readable name.
@@ -15,80 +17,13 @@
  * value is not recognized, where n is the integer value of the enum.
  */
 inline std::string packetTypeToString(PacketType type) {
-  switch (type) {
-    case PacketType::ChatMessage:
-      return "ChatMessage";
-    case PacketType::PlayerMove:
-      return "Move";
-    case PacketType::NewPlayer:
-      return "NewPlayer";
-    case PacketType::PlayerInfo:
-      return "PlayerInfo";
-    case PacketType::EnemySpawn:
-      return "EnemySpawn";
-    case PacketType::EnemyMove:
-      return "EnemyMove";
-    case PacketType::EnemyDeath:
-      return "EnemyDeath";
-    case PacketType::PlayerShoot:
-      return "PlayerShoot";
-    case PacketType::ProjectileSpawn:
-      return "ProjectileSpawn";
-    case PacketType::ProjectileHit:
-      return "ProjectileHit";
-    case PacketType::ProjectileDestroy:
-      return "ProjectileDestroy";
-    case PacketType::GameStart:
-      return "GameStart";
-    case PacketType::GameEnd:
-      return "GameEnd";
-    case PacketType::PlayerDisconnected:
-      return "PlayerDisconnected";
-    case PacketType::Heartbeat:
-      return "Heartbeat";
-    case PacketType::EnemyHit:
-      return "EnemyHit";
-    case PacketType::PlayerHit:
-      return "PlayerHit";
-    case PacketType::PlayerDeath:
-      return "PlayerDeath";
-    case PacketType::CreateRoom:
-      return "CreateRoom";
-    case PacketType::JoinRoom:
-      return "JoinRoom";
-    case PacketType::JoinRoomResponse:
-      return "JoinRoomResponse";
-    case PacketType::ListRoom:
-      return "ListRoom";
-    case PacketType::ListRoomResponse:
-      return "ListRoomResponse";
-    case PacketType::MatchmakingRequest:
-      return "MatchmakingRequest";
-    case PacketType::MatchmakingResponse:
-      return "MatchmakingResponse";
-    case PacketType::PlayerInput:
-      return "PlayerInput";
-    case PacketType::Ping:
-      return "Ping";
-    case PacketType::Pong:
-      return "Pong";
-    case PacketType::Ack:
-      return "Ack";
-    case PacketType::RequestChallenge:
-      return "RequestChallenge";
-    case PacketType::ChallengeResponse:
-      return "ChallengeResponse";
-    case PacketType::CreateRoomResponse:
-      return "CreateRoomResponse";
-    case PacketType::ScoreboardRequest:
-      return "ScoreboardRequest";
-    case PacketType::ScoreboardResponse:
-      return "ScoreboardResponse";
-    default:
-      std::stringstream ss;
-      ss << "Unknown(" << static_cast<int>(type) << ")";
-      return ss.str();
+  const PacketInfo &info = getPacketInfo(type);
+  if (info.registered) {
+    return std::string(info.name);
   }
+  std::stringstream ss;
+  ss << "Unknown(" << static_cast<int>(type) << ")";
+  return ss.str();
 }
 
 /**
@@ -98,37 +33,42 @@ inline std::string packetTypeToString(PacketType type) {
  * @return `true` if packets of this type require an acknowledgement, `false`
  * otherwise.
  */
-inline bool shouldAcknowledgePacketType(PacketType type) {
-  switch (type) {
-    case PacketType::GameStart:
-    case PacketType::GameEnd:
-    case PacketType::PlayerInfo:
-    case PacketType::PlayerShoot:
-    case PacketType::PlayerHit:
-    case PacketType::PlayerDeath:
-    case PacketType::CreateRoom:
-    case PacketType::JoinRoom:
-    case PacketType::JoinRoomResponse:
-    case PacketType::PlayerDisconnected:
-    case PacketType::ChatMessage:
-    case PacketType::NewPlayer:
-    case PacketType::EnemySpawn:
-    case PacketType::EnemyDeath:
-    case PacketType::EnemyHit:
-    case PacketType::ProjectileSpawn:
-    case PacketType::ProjectileDestroy:
-    case PacketType::MatchmakingRequest:
-    case PacketType::MatchmakingResponse:
-    case PacketType::RequestChallenge:
-    case PacketType::CreateRoomResponse:
-      return true;
-    default:
-      return false;
-  }
+constexpr bool shouldAcknowledgePacketType(PacketType type) {
+  return getPacketInfo(type).acknowledged;
+}
+
+/**
+ * @brief Determines whether packets of the given type are sent compressed
+ * when that makes them smaller.
+ *
+ * @param type PacketType value to check.
+ * @return `true` if the type opts in to compression, `false` otherwise.
+ */
+constexpr bool shouldCompressPacketType(PacketType type) {
+  return getPacketInfo(type).compressed;
 }
 
+/**
+ * @brief Reliable packet kept for retransmission until the peer acknowledges
+ * it.
+ *
+ * @var sequence_number Sequence number the packet was built with.
+ * @var ack_sequence Ack sequence of the datagram that last carried the
+ * packet; an ack header acknowledging it acknowledges the packet. Empty until
+ * the packet is matched to a datagram.
+ * @var pending_fragments For a packet sent in fragments, those still
+ * unacknowledged: bit `i` stands for the datagram `ack_sequence - i`. The
+ * packet is acknowledged once none is left.
+ * @var resend_at Time the packet is retransmitted unless acknowledged
+ * before: last_sent plus the connection's retransmission timeout, backed off
+ * by resend_count.
+ */
 struct UnacknowledgedPacket {
     std::shared_ptr<std::vector<uint8_t>> data;
+    std::uint32_t sequence_number;
     int resend_count;
     std::chrono::steady_clock::time_point last_sent;
+    std::optional<std::uint16_t> ack_sequence;
+    std::uint32_t pending_fragments = 1;
+    std::chrono::steady_clock::time_point resend_at;
 };
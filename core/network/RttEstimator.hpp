@@ -0,0 +1,81 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include "Macro.hpp"
+
+namespace network {
+
+  /**
+   * @brief Smoothed round-trip time of one connection and the retransmission
+   * timeout derived from it, computed as in RFC 6298.
+   *
+   * Samples come from Ping/Pong round trips and from the time reliable
+   * packets take to be acknowledged. Until the first sample the timeout is
+   * INITIAL_RTO_MS; afterwards it is `srtt + 4 * rttvar`, clamped to
+   * [MIN_RTO_MS, MAX_RTO_MS]. Each retransmission of a packet doubles its
+   * timeout, up to MAX_RTO_MS.
+   *
+   * Not synchronized: the owner guards it with the lock of its retransmit
+   * queue.
+   */
+  class RttEstimator {
+    public:
+      /**
+       * @brief Fold a measured round trip into the smoothed estimates.
+       */
+      void addSample(std::chrono::milliseconds sample) {
+        const double rtt = static_cast<double>(
+            std::max<std::chrono::milliseconds::rep>(sample.count(), 0));
+        if (!_hasSample) {
+          _srtt = rtt;
+          _rttvar = rtt / 2.0;
+          _hasSample = true;
+          return;
+        }
+        const double error = rtt > _srtt ? rtt - _srtt : _srtt - rtt;
+        _rttvar = (1.0 - RTT_BETA) * _rttvar + RTT_BETA * error;
+        _srtt = (1.0 - RTT_ALPHA) * _srtt + RTT_ALPHA * rtt;
+      }
+
+      /**
+       * @brief Timeout before the first retransmission of a packet.
+       */
+      std::chrono::milliseconds getRto() const {
+        if (!_hasSample)
+          return std::chrono::milliseconds(INITIAL_RTO_MS);
+        const auto rto = static_cast<std::int64_t>(_srtt + 4.0 * _rttvar);
+        return std::chrono::milliseconds(
+            std::clamp<std::int64_t>(rto, MIN_RTO_MS, MAX_RTO_MS));
+      }
+
+      /**
+       * @brief Timeout before the next retransmission of a packet already
+       * sent `attempts` extra times: the RTO doubled once per attempt.
+       */
+      std::chrono::milliseconds getBackoffRto(int attempts) const {
+        auto rto = getRto();
+        for (int i = 0; i < attempts && rto.count() < MAX_RTO_MS; ++i)
+          rto *= 2;
+        return std::min(rto, std::chrono::milliseconds(MAX_RTO_MS));
+      }
+
+      std::chrono::milliseconds getSmoothedRtt() const {
+        return std::chrono::milliseconds(static_cast<std::int64_t>(_srtt));
+      }
+
+      bool hasSample() const {
+        return _hasSample;
+      }
+
+    private:
+      static constexpr double RTT_ALPHA = 1.0 / 8.0;
+      static constexpr double RTT_BETA = 1.0 / 4.0;
+
+      double _srtt = 0.0;
+      double _rttvar = 0.0;
+      bool _hasSample = false;
+  };
+
+}  // namespace network
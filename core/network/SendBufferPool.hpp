@@ -0,0 +1,114 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Macro.hpp"
+
+namespace network {
+
+  /**
+   * @brief Fixed set of reusable send buffers, handed out as the
+   * `shared_ptr<vector<uint8_t>>` the send paths already take.
+   *
+   * Every buffer is reserved to SEND_BUFFER_CAPACITY bytes up front, so
+   * serializing a packet into it does not allocate. A buffer returns to the
+   * pool when its last owner (the send completion handler, a retransmit
+   * queue...) drops it. Taking and returning buffers is lock-free: each slot
+   * has an atomic busy flag, claimed with an exchange.
+   *
+   * When every slot is busy acquire() falls back to a plain heap buffer, so
+   * the pool bounds memory reuse, not the number of packets in flight. The
+   * slots are shared with the buffers handed out, so buffers may outlive the
+   * pool.
+   */
+  class SendBufferPool {
+    public:
+      explicit SendBufferPool(std::size_t capacity = SEND_BUFFER_POOL_SIZE)
+          : _state(std::make_shared<State>(capacity)) {
+      }
+
+      SendBufferPool(const SendBufferPool &) = delete;
+      SendBufferPool &operator=(const SendBufferPool &) = delete;
+
+      /**
+       * @brief Take an empty buffer with at least SEND_BUFFER_CAPACITY bytes
+       * reserved.
+       *
+       * @return std::shared_ptr<std::vector<std::uint8_t>> Buffer that goes
+       * back to the pool when released.
+       */
+      std::shared_ptr<std::vector<std::uint8_t>> acquire() {
+        State &state = *_state;
+        const std::size_t count = state.slots.size();
+        const std::size_t start =
+            state.next.fetch_add(1, std::memory_order_relaxed);
+        for (std::size_t i = 0; i < count; ++i) {
+          const std::size_t index = (start + i) % count;
+          Slot &slot = state.slots[index];
+          if (slot.busy.load(std::memory_order_relaxed) ||
+              slot.busy.exchange(true, std::memory_order_acquire))
+            continue;
+          return std::shared_ptr<std::vector<std::uint8_t>>(
+              &slot.buffer, Release{_state, index});
+        }
+        auto buffer = std::make_shared<std::vector<std::uint8_t>>();
+        buffer->reserve(SEND_BUFFER_CAPACITY);
+        return buffer;
+      }
+
+      /**
+       * @brief Take a buffer holding a copy of `size` bytes at `data`.
+       */
+      std::shared_ptr<std::vector<std::uint8_t>> acquire(const char *data,
+                                                         std::size_t size) {
+        auto buffer = acquire();
+        buffer->assign(data, data + size);
+        return buffer;
+      }
+
+      std::size_t getCapacity() const {
+        return _state->slots.size();
+      }
+
+    private:
+      struct Slot {
+          std::vector<std::uint8_t> buffer;
+          std::atomic<bool> busy{false};
+      };
+
+      struct State {
+          explicit State(std::size_t capacity) : slots(capacity) {
+            for (auto &slot : slots)
+              slot.buffer.reserve(SEND_BUFFER_CAPACITY);
+          }
+
+          std::vector<Slot> slots;
+          std::atomic<std::size_t> next{0};
+      };
+
+      /**
+       * @brief Deleter of pooled buffers: empties the buffer, drops it if it
+       * grew past SEND_BUFFER_CAPACITY for an oversized packet, and frees
+       * the slot.
+       */
+      struct Release {
+          std::shared_ptr<State> state;
+          std::size_t index;
+
+          void operator()(std::vector<std::uint8_t> *buffer) const {
+            buffer->clear();
+            if (buffer->capacity() > SEND_BUFFER_CAPACITY) {
+              std::vector<std::uint8_t>().swap(*buffer);
+              buffer->reserve(SEND_BUFFER_CAPACITY);
+            }
+            state->slots[index].busy.store(false, std::memory_order_release);
+          }
+      };
+
+      std::shared_ptr<State> _state;
+  };
+
+}  // namespace network
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <bitsery/adapter/buffer.h>
+#include <bitsery/adapter/measure_size.h>
 #include <bitsery/bitsery.h>
 #include <optional>
 #include "PacketSerialize.hpp"
@@ -12,23 +13,69 @@ namespace serialization {
       template <typename Packet>
       static Buffer serialize(const Packet &packet) {
         Buffer buffer;
+        serializeInto(buffer, packet);
+        return buffer;
+      }
+
+      /**
+       * @brief Serialize a packet into an existing buffer, replacing its
+       * contents but keeping its capacity, e.g. a pooled send buffer.
+       *
+       * @return std::size_t Number of bytes written (the buffer's new size).
+       */
+      template <typename Packet>
+      static std::size_t serializeInto(Buffer &buffer, const Packet &packet) {
+        buffer.clear();
         auto writtenSize =
             bitsery::quickSerialization<OutputAdapter>(buffer, packet);
         buffer.resize(writtenSize);
-        return buffer;
+        return writtenSize;
       }
 
+      /**
+       * @brief Serialized size of a packet, computed by walking its fields
+       * without writing them anywhere.
+       */
       template <typename Packet>
-      static std::optional<Packet> deserialize(const Buffer &buffer) {
+      static std::size_t measure(const Packet &packet) {
+        bitsery::Serializer<bitsery::MeasureSize> serializer;
+        serializer.object(packet);
+        return serializer.adapter().writtenBytesCount();
+      }
+
+      /**
+       * @brief Deserialize a packet straight from a view over its bytes, such
+       * as the receive buffer, without copying them first.
+       */
+      template <typename Packet>
+      static std::optional<Packet> deserialize(ByteView bytes) {
         Packet packet;
         auto state = bitsery::quickDeserialization<InputAdapter>(
-            {buffer.begin(), buffer.size()}, packet);
+            {bytes.data(), bytes.size()}, packet);
 
         if (state.first == bitsery::ReaderError::NoError) {
           return packet;
         }
         return std::nullopt;
       }
+
+      /**
+       * @brief Deserialize into an existing object, e.g. a
+       * serialization::Compact view over a packet.
+       *
+       * @return bool true if the bytes held a valid object.
+       */
+      template <typename Packet>
+      static bool deserializeInto(ByteView bytes, Packet &packet) {
+        auto state = bitsery::quickDeserialization<InputAdapter>(
+            {bytes.data(), bytes.size()}, packet);
+        return state.first == bitsery::ReaderError::NoError;
+      }
+
+      template <typename Packet>
+      static std::optional<Packet> deserialize(const Buffer &buffer) {
+        return deserialize<Packet>(ByteView(buffer));
+      }
   };
 
 }  // namespace serialization
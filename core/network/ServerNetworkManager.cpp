@@ -1,11 +1,21 @@
 #include "ServerNetworkManager.hpp"
+#include <cerrno>
+#include <cstring>
 #include <iostream>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include "CompactCodec.hpp"
 #include "Macro.hpp"
+#include "PacketBundle.hpp"
 #include "PacketCompressor.hpp"
+#include "PacketFragmenter.hpp"
 
 using namespace network;
 
+thread_local ServerNetworkManager::Shard *ServerNetworkManager::_currentShard =
+    nullptr;
+
 /**
  * @brief Constructs a ServerNetworkManager bound to a specific port.
  *
@@ -13,14 +23,140 @@ using namespace network;
  * timers needed for running the network service.
  *
  * @param port UDP port number the server will listen on.
+ * @param batched_io On Linux, receive up to RECV_BATCH_SIZE datagrams per
+ * readiness event with recvmmsg and flush queued sends with sendmmsg. Ignored
+ * on other platforms, which always use one asio operation per datagram.
+ * @param socket_count Number of SO_REUSEPORT sockets opened on `port`, each
+ * served by its own io_context thread (see openShards()). Linux only; other
+ * platforms always use a single socket.
  */
-ServerNetworkManager::ServerNetworkManager(std::uint16_t port)
+ServerNetworkManager::ServerNetworkManager(std::uint16_t port,
+                                           bool batched_io,
+                                           std::size_t socket_count)
     : BaseNetworkManager(port),
       _isRunning(true),
       _signals(_io_context, SIGINT, SIGTERM),
       _eventTimer(std::make_shared<asio::steady_timer>(_io_context)),
       _timeoutTimer(std::make_shared<asio::steady_timer>(_io_context)),
-      _unacknowledgedTimer(std::make_shared<asio::steady_timer>(_io_context)) {
+      _unacknowledgedTimer(std::make_shared<asio::steady_timer>(_io_context)),
+#ifdef __linux__
+      _batchedIo(batched_io) {
+#else
+      _batchedIo(false) {
+  (void)batched_io;
+#endif
+  openShards(port, socket_count);
+}
+
+ServerNetworkManager::~ServerNetworkManager() {
+  stopShardThreads();
+}
+
+/**
+ * @brief Open the sockets the server listens on.
+ *
+ * With more than one socket, every socket (the base class one included) is
+ * reopened with SO_REUSEPORT on the same port. The kernel then spreads
+ * incoming datagrams across them by hashing the 4-tuple, so all the traffic
+ * of a given client always lands on the same socket, and thus on the same
+ * thread.
+ *
+ * @param port UDP port shared by the sockets.
+ * @param socket_count Requested number of sockets, at least one.
+ */
+void ServerNetworkManager::openShards(std::uint16_t port,
+                                      std::size_t socket_count) {
+#ifndef __linux__
+  if (socket_count > 1) {
+    std::cerr << "[WARNING] Multiple sockets per port are only supported on "
+                 "Linux, using a single socket"
+              << std::endl;
+    socket_count = 1;
+  }
+#endif
+  if (socket_count == 0)
+    socket_count = 1;
+
+  _shards.push_back(std::make_unique<Shard>(0, _io_context, _socket));
+  if (socket_count > 1)
+    prepareSocket(_socket, port, true);
+  else if (_batchedIo)
+    _socket.non_blocking(true);
+
+  for (std::size_t i = 1; i < socket_count; ++i) {
+    auto context = std::make_unique<asio::io_context>();
+    auto socket = std::make_unique<asio::ip::udp::socket>(*context);
+    prepareSocket(*socket, port, true);
+    auto shard = std::make_unique<Shard>(i, *context, *socket);
+    shard->owned_io_context = std::move(context);
+    shard->owned_socket = std::move(socket);
+    _shards.push_back(std::move(shard));
+  }
+
+  for (auto &shard : _shards) {
+    shard->send_queue.reserve(SEND_BATCH_SIZE);
+    shard->send_batch.reserve(SEND_BATCH_SIZE);
+  }
+}
+
+/**
+ * @brief (Re)open `socket` on `port`, with SO_REUSEPORT set before binding
+ * when requested, and in non-blocking mode for batched I/O.
+ */
+void ServerNetworkManager::prepareSocket(asio::ip::udp::socket &socket,
+                                         std::uint16_t port,
+                                         bool reuse_port) {
+  if (socket.is_open())
+    socket.close();
+  socket.open(asio::ip::udp::v4());
+#ifdef __linux__
+  if (reuse_port)
+    socket.set_option(
+        asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT>(true));
+#else
+  (void)reuse_port;
+#endif
+  socket.bind(asio::ip::udp::endpoint(asio::ip::udp::v4(), port));
+  if (_batchedIo)
+    socket.non_blocking(true);
+}
+
+/**
+ * @brief Shard served by the calling thread; shard 0 for threads that do not
+ * run one of this manager's io_contexts.
+ */
+ServerNetworkManager::Shard &ServerNetworkManager::currentShard() {
+  Shard *shard = _currentShard;
+  if (shard && shard->index < _shards.size() &&
+      _shards[shard->index].get() == shard)
+    return *shard;
+  return *_shards.front();
+}
+
+std::size_t ServerNetworkManager::getCurrentShard() {
+  return currentShard().index;
+}
+
+/**
+ * @brief Shard owning a client's traffic, i.e. the one whose socket received
+ * its first packet; 0 for unknown clients.
+ */
+std::size_t ServerNetworkManager::getClientShard(int id) const {
+  std::shared_lock<std::shared_mutex> lock(_clientRoutesMutex);
+  auto it = _clientRoutes.find(id);
+  return it != _clientRoutes.end() ? it->second.shard : 0;
+}
+
+asio::io_context &ServerNetworkManager::getIoContext(std::size_t shard) {
+  return _shards[shard < _shards.size() ? shard : 0]->io_context;
+}
+
+/**
+ * @brief Run `task` on the thread serving `shard`.
+ */
+void ServerNetworkManager::post(std::size_t shard,
+                                std::function<void()> task) {
+  asio::post(getIoContext(shard), std::move(task));
 }
 
 /**
@@ -28,76 +164,484 @@ ServerNetworkManager::ServerNetworkManager(std::uint16_t port)
  * communication.
  *
  * Stores or updates the mapping from the given client `id` to the provided UDP
- * `endpoint`.
+ * `endpoint`. The client is bound to the shard of the calling thread, which is
+ * the one its packets are received on, so replies leave from the same socket.
  *
  * @param id Client identifier used as the key for the mapping.
  * @param endpoint UDP endpoint (address and port) associated with the client.
+ * @return ClientRoute The route stored for the client, for callers that cache
+ * it (see sendPrepared()).
+ *
+ * @note The client's AckChannel and OutboundBundle are kept when it
+ * registers again from the same endpoint, and started afresh otherwise.
  */
-void ServerNetworkManager::registerClient(
+ClientRoute ServerNetworkManager::registerClient(
     int id, const asio::ip::udp::endpoint &endpoint) {
-  _clientEndpoints[id] = endpoint;
+  std::lock_guard<std::shared_mutex> lock(_clientRoutesMutex);
+  ClientRoute &route = _clientRoutes[id];
+  if (!route.acks || route.endpoint != endpoint) {
+    route.acks = std::make_shared<AckChannel>();
+    route.outbound = std::make_shared<OutboundBundle>();
+    route.budget = std::make_shared<TokenBucket>(
+        _clientSendRate, _clientSendRate * SEND_BUDGET_BURST_MS / 1000);
+  }
+  route.endpoint = endpoint;
+  route.shard = currentShard().index;
+  return route;
 }
 
 void ServerNetworkManager::unregisterClient(int id) {
-  _clientEndpoints.erase(id);
+  std::lock_guard<std::shared_mutex> lock(_clientRoutesMutex);
+  _clientRoutes.erase(id);
 }
 
 void ServerNetworkManager::sendToClient(int id, const char *data,
                                         std::size_t size) {
-  auto buffer = std::make_shared<std::vector<std::uint8_t>>(data, data + size);
-  sendToClient(id, buffer);
+  sendToClient(id, _sendBuffers.acquire(data, size));
 }
 
 void ServerNetworkManager::sendToClient(
     int id, std::shared_ptr<std::vector<std::uint8_t>> buffer) {
-  auto it = _clientEndpoints.find(id);
-  if (it == _clientEndpoints.end())
-    return;
+  ClientRoute route;
+  {
+    std::shared_lock<std::shared_mutex> lock(_clientRoutesMutex);
+    auto it = _clientRoutes.find(id);
+    if (it == _clientRoutes.end())
+      return;
+    route = it->second;
+  }
+
+  const void *source = buffer.get();
+  sendTo(route, prepareForWire(std::move(buffer)), source);
+}
+
+/**
+ * @brief Turn a serialized packet into the datagram sent on the wire:
+ * compressed when its type opts in and compression pays off, unchanged
+ * otherwise.
+ *
+ * Already compressed buffers are returned as is, so a buffer prepared once
+ * can be handed to every recipient and to the retransmit queues without
+ * being compressed again. The returned buffer must not be modified, since it
+ * may be shared.
+ *
+ * @param buffer Serialized packet.
+ * @return std::shared_ptr<std::vector<std::uint8_t>> Datagram to send.
+ */
+std::shared_ptr<std::vector<std::uint8_t>> ServerNetworkManager::prepareForWire(
+    std::shared_ptr<std::vector<std::uint8_t>> buffer) {
+  // Callers without a manager at hand use this too, hence a pool of its own
+  static SendBufferPool compressedBuffers;
+  return compressForWire(compressedBuffers, buffer);
+}
+
+/**
+ * @brief Send a datagram prepared with prepareForWire() along a cached client
+ * route, without looking the client up or compressing anything.
+ *
+ * @param route Route returned by registerClient() for the recipient.
+ * @param buffer Prepared datagram, possibly shared with other recipients.
+ * @return std::uint16_t Ack sequence the datagram was sent with.
+ */
+std::uint16_t ServerNetworkManager::sendPrepared(
+    const ClientRoute &route,
+    std::shared_ptr<std::vector<std::uint8_t>> buffer) {
+  return sendTo(route, std::move(buffer));
+}
+
+/**
+ * @brief Send a datagram holding only an ack header to a client that has
+ * been sent nothing for ACK_FLUSH_DELAY_MS since a datagram arrived from it,
+ * so its reliable packets are acknowledged even when there is no traffic to
+ * piggyback on.
+ */
+void ServerNetworkManager::flushAcks(const ClientRoute &route) {
+  if (route.acks && route.acks->hasPendingAck(
+                        std::chrono::milliseconds(ACK_FLUSH_DELAY_MS)))
+    sendTo(route, _sendBuffers.acquire());
+}
+
+/**
+ * @brief Pack the packets sent to a client into bundles of at most the
+ * configured MTU from now on, for a client that advertised
+ * CAPABILITY_AGGREGATION.
+ *
+ * @return true if aggregation is on for the client, false if it is disabled
+ * on this server.
+ */
+bool ServerNetworkManager::enableAggregation(const ClientRoute &route) {
+  if (_aggregationMtu == 0 || !route.outbound)
+    return false;
+  route.outbound->mtu.store(_aggregationMtu, std::memory_order_relaxed);
+  return true;
+}
 
-  std::shared_ptr<std::vector<std::uint8_t>> dataToSend = buffer;
-  if (buffer->size() > COMPRESSION_THRESHOLD) {
-    auto compressed = compression::Compressor::compress(*buffer);
-    if (compression::Compressor::isCompressed(compressed)) {
-      dataToSend = std::make_shared<std::vector<std::uint8_t>>(compressed);
+/**
+ * @brief Send packets to a client in their compact encoding from now on, for
+ * a client that advertised CAPABILITY_COMPACT.
+ *
+ * @return true if compact encoding is on for the client.
+ */
+bool ServerNetworkManager::enableCompactEncoding(const ClientRoute &route) {
+  if (!route.outbound)
+    return false;
+  route.outbound->compact.store(true, std::memory_order_relaxed);
+  return true;
+}
+
+/**
+ * @brief Compact encoding of a prepared datagram, decompressed first if
+ * needed; null if its packet type has no compact encoding or the datagram as
+ * prepared, e.g. compressed, is already no larger.
+ *
+ * The last translation is kept per thread, so a broadcast to several compact
+ * clients translates its datagram once. Prepared datagrams are never
+ * modified, and the one kept cannot be recycled while it is, so its address
+ * identifies it.
+ */
+std::shared_ptr<std::vector<std::uint8_t>> ServerNetworkManager::toCompact(
+    const std::shared_ptr<std::vector<std::uint8_t>> &buffer) {
+  thread_local std::shared_ptr<std::vector<std::uint8_t>> lastPrepared;
+  thread_local std::shared_ptr<std::vector<std::uint8_t>> lastCompact;
+  if (buffer == lastPrepared)
+    return lastCompact;
+
+  serialization::ByteView packet(*buffer);
+  if (compression::Compressor::isCompressed(packet))
+    packet = compression::Compressor::decompressToScratch(packet);
+  std::shared_ptr<std::vector<std::uint8_t>> compact;
+  if (!packet.empty() &&
+      getPacketInfo(static_cast<PacketType>(packet[0])).compact) {
+    compact = _sendBuffers.acquire();
+    const std::size_t size =
+        serialization::CompactCodec::encode(packet, *compact);
+    if (size == 0 || size >= buffer->size())
+      compact.reset();
+  }
+  lastPrepared = buffer;
+  lastCompact = compact;
+  return compact;
+}
+
+/**
+ * @brief Stamp a datagram with the route's ack header and send it from the
+ * route's shard socket, either right away with its own asio operation or, in
+ * batched mode, by queueing it for the next sendmmsg flush.
+ *
+ * A flush is posted on the shard's io_context when the first datagram is
+ * queued, so everything sent by the handlers that run before it shares one
+ * syscall. Packets for a client with aggregation enabled go through
+ * sendBundled() instead, unless they are too big to share a datagram, and
+ * packets too big for a datagram of FRAGMENT_MTU bytes through
+ * sendFragmented(). Packets for a client with compact encoding enabled are
+ * translated first. Every packet is charged to the route's send budget.
+ *
+ * @param route Destination client.
+ * @param buffer Payload; kept alive until it has been handed to the kernel.
+ * @param source Buffer recorded in the ack history instead of `buffer`, when
+ * `buffer` is a compressed copy of what the caller tracks.
+ * @return std::uint16_t Ack sequence the datagram was sent with.
+ */
+std::uint16_t ServerNetworkManager::sendTo(
+    const ClientRoute &route, std::shared_ptr<std::vector<std::uint8_t>> buffer,
+    const void *source) {
+  if (route.shard >= _shards.size())
+    return 0;
+  Shard &shard = *_shards[route.shard];
+  if (route.outbound && !buffer->empty() &&
+      route.outbound->compact.load(std::memory_order_relaxed)) {
+    if (auto compact = toCompact(buffer)) {
+      if (!source)
+        source = buffer.get();
+      buffer = std::move(compact);
     }
   }
+  if (PacketFragmenter::needsFragments(buffer->size()))
+    return sendFragmented(shard, route, buffer, source);
+  if (route.budget)
+    route.budget->consume(ACK_HEADER_SIZE + buffer->size());
+  if (route.outbound && route.acks && !buffer->empty()) {
+    const std::size_t mtu =
+        route.outbound->mtu.load(std::memory_order_relaxed);
+    const std::size_t alone = ACK_HEADER_SIZE + AGGREGATION_HEADER_SIZE +
+                              PacketBundle::framedSize(buffer->size());
+    if (mtu != 0 && alone <= mtu)
+      return sendBundled(shard, route, mtu, std::move(buffer), source);
+  }
+
+  PendingSend pending{route.endpoint, std::move(buffer)};
+  AckHeader header;
+  if (route.acks)
+    header = route.acks->stamp(source ? source : pending.buffer.get());
+  header.write(pending.ack_header.data());
+  dispatch(shard, std::move(pending));
+  return header.sequence;
+}
 
-  const auto &endpoint = it->second;
-  _socket.async_send_to(
-      asio::buffer(*dataToSend), endpoint,
-      [dataToSend](const asio::error_code &error, std::size_t) {
+/**
+ * @brief Append a packet to the client's open bundle, opening one if needed
+ * and sending the current one first when the packet would not fit in it.
+ *
+ * The bundle's datagram sequence is reserved when it is opened, so the
+ * packet is recorded in the ack history right away and reliable packets are
+ * matched to the bundle as if it had been sent. Opening a bundle posts its
+ * closing on the shard's io_context, which runs once the handlers queued
+ * before it, i.e. the current I/O pass, are done.
+ *
+ * @return std::uint16_t Ack sequence of the bundle carrying the packet.
+ */
+std::uint16_t ServerNetworkManager::sendBundled(
+    Shard &shard, const ClientRoute &route, std::size_t mtu,
+    std::shared_ptr<std::vector<std::uint8_t>> buffer, const void *source) {
+  OutboundBundle &bundle = *route.outbound;
+  bool opened = false;
+  std::uint16_t sequence;
+  {
+    std::lock_guard<std::mutex> lock(bundle.mutex);
+    const std::size_t framed = PacketBundle::framedSize(buffer->size());
+    if (bundle.buffer &&
+        ACK_HEADER_SIZE + bundle.buffer->size() + framed > mtu)
+      dispatch(shard, takeBundle(route));
+    if (!bundle.buffer) {
+      bundle.buffer = _sendBuffers.acquire();
+      PacketBundle::begin(*bundle.buffer);
+      bundle.sequence = route.acks->reserve();
+      opened = true;
+    }
+    PacketBundle::append(*bundle.buffer, *buffer);
+    if (bundle.count++ == 0)
+      bundle.first = buffer;
+    route.acks->record(bundle.sequence, source ? source : buffer.get());
+    sequence = bundle.sequence;
+  }
+  if (opened)
+    asio::post(shard.io_context,
+               [this, &shard, route]() { closeBundle(shard, route); });
+  return sequence;
+}
+
+/**
+ * @brief Send a packet too large for one datagram as PacketFragmenter
+ * fragments, in consecutive datagrams, each on its own.
+ *
+ * The packet is recorded in the ack history under the last fragment's
+ * sequence only; the fragments before it are known from the packet size
+ * (see PacketFragmenter::fragmentMask()).
+ *
+ * @return std::uint16_t Ack sequence of the last fragment; 0 if the packet
+ * needs more than MAX_FRAGMENTS and was dropped.
+ */
+std::uint16_t ServerNetworkManager::sendFragmented(
+    Shard &shard, const ClientRoute &route,
+    const std::shared_ptr<std::vector<std::uint8_t>> &buffer,
+    const void *source) {
+  const std::size_t count = PacketFragmenter::fragmentCount(buffer->size());
+  if (count == 0) {
+    std::cerr << "[ERROR] Packet of " << buffer->size()
+              << " bytes needs more than " << MAX_FRAGMENTS
+              << " fragments, dropping" << std::endl;
+    return 0;
+  }
+
+  const std::uint16_t message =
+      _nextFragmentedMessage.fetch_add(1, std::memory_order_relaxed);
+  const std::uint16_t first =
+      route.acks ? route.acks->reserve(static_cast<std::uint16_t>(count)) : 0;
+  const auto last = static_cast<std::uint16_t>(first + count - 1);
+  if (route.acks)
+    route.acks->record(last, source ? source : buffer.get());
+  for (std::size_t i = 0; i < count; ++i) {
+    PendingSend pending{route.endpoint, _sendBuffers.acquire()};
+    PacketFragmenter::write(*pending.buffer, *buffer, message, i, count);
+    if (route.budget)
+      route.budget->consume(ACK_HEADER_SIZE + pending.buffer->size());
+    AckHeader header;
+    if (route.acks)
+      header = route.acks->header(static_cast<std::uint16_t>(first + i));
+    header.write(pending.ack_header.data());
+    dispatch(shard, std::move(pending));
+  }
+  return last;
+}
+
+/**
+ * @brief Send the client's open bundle, if any.
+ */
+void ServerNetworkManager::closeBundle(Shard &shard, const ClientRoute &route) {
+  std::lock_guard<std::mutex> lock(route.outbound->mutex);
+  if (route.outbound->buffer)
+    dispatch(shard, takeBundle(route));
+}
+
+/**
+ * @brief Turn the open bundle into a datagram stamped with its reserved
+ * sequence, leaving no bundle open. Called with the bundle's mutex held.
+ */
+ServerNetworkManager::PendingSend ServerNetworkManager::takeBundle(
+    const ClientRoute &route) {
+  OutboundBundle &bundle = *route.outbound;
+  PendingSend pending{route.endpoint, bundle.count == 1
+                                          ? std::move(bundle.first)
+                                          : std::move(bundle.buffer)};
+  bundle.buffer.reset();
+  bundle.first.reset();
+  bundle.count = 0;
+  route.acks->header(bundle.sequence).write(pending.ack_header.data());
+  return pending;
+}
+
+/**
+ * @brief Send a stamped datagram with its own asio operation or, in batched
+ * mode, queue it for the shard's next sendmmsg flush.
+ */
+void ServerNetworkManager::dispatch(Shard &shard, PendingSend pending) {
+  if (!_batchedIo) {
+    sendNow(shard, std::make_shared<PendingSend>(std::move(pending)));
+    return;
+  }
+
+  bool scheduleFlush = false;
+  {
+    std::lock_guard<std::mutex> lock(shard.send_mutex);
+    shard.send_queue.push_back(std::move(pending));
+    scheduleFlush = !shard.flush_scheduled;
+    shard.flush_scheduled = true;
+  }
+  if (scheduleFlush)
+    asio::post(shard.io_context, [this, &shard]() { flushSends(shard); });
+}
+
+/**
+ * @brief Send one datagram with its own asio operation, gathering the ack
+ * header and the payload. Sends issued from another thread are posted to the
+ * shard's thread, since its socket is only used from there.
+ */
+void ServerNetworkManager::sendNow(Shard &shard,
+                                   std::shared_ptr<PendingSend> pending) {
+  if (_currentShard != &shard) {
+    asio::post(shard.io_context,
+               [this, &shard, pending]() { sendNow(shard, pending); });
+    return;
+  }
+  const std::array<asio::const_buffer, 2> buffers{
+      asio::buffer(pending->ack_header), asio::buffer(*pending->buffer)};
+  shard.socket.async_send_to(
+      buffers, pending->endpoint,
+      [pending](const asio::error_code &error, std::size_t) {
         if (error)
-          std::cerr << "[ERROR] Send failed: " << error.message() << std::endl;
+          std::cerr << "[ERROR] Send failed: " << error.message()
+                    << std::endl;
       });
 }
 
+/**
+ * @brief Hand every datagram queued on a shard to the kernel with as few
+ * sendmmsg calls as possible (SEND_BATCH_SIZE datagrams each).
+ *
+ * Datagrams the kernel does not take right away (full socket buffer) fall
+ * back to a regular asynchronous send, so nothing is dropped here. Runs on
+ * the shard's thread.
+ */
+void ServerNetworkManager::flushSends(Shard &shard) {
+  {
+    std::lock_guard<std::mutex> lock(shard.send_mutex);
+    shard.send_batch.swap(shard.send_queue);
+    shard.flush_scheduled = false;
+  }
+  auto &batch = shard.send_batch;
+  if (batch.empty() || !shard.socket.is_open()) {
+    batch.clear();
+    return;
+  }
+
+#ifdef __linux__
+  const int fd = shard.socket.native_handle();
+  std::size_t offset = 0;
+  while (offset < batch.size()) {
+    const std::size_t count = std::min(SEND_BATCH_SIZE, batch.size() - offset);
+    for (std::size_t i = 0; i < count; ++i) {
+      PendingSend &pending = batch[offset + i];
+      iovec *iovecs = &shard.send_iovecs[2 * i];
+      iovecs[0].iov_base = pending.ack_header.data();
+      iovecs[0].iov_len = pending.ack_header.size();
+      iovecs[1].iov_base = pending.buffer->data();
+      iovecs[1].iov_len = pending.buffer->size();
+      std::memset(&shard.send_headers[i], 0, sizeof(mmsghdr));
+      shard.send_headers[i].msg_hdr.msg_name = pending.endpoint.data();
+      shard.send_headers[i].msg_hdr.msg_namelen =
+          static_cast<socklen_t>(pending.endpoint.size());
+      shard.send_headers[i].msg_hdr.msg_iov = iovecs;
+      shard.send_headers[i].msg_hdr.msg_iovlen = 2;
+    }
+
+    int sent = ::sendmmsg(fd, shard.send_headers.data(),
+                          static_cast<unsigned int>(count), MSG_DONTWAIT);
+    if (sent < 0) {
+      if (errno != EAGAIN && errno != EWOULDBLOCK)
+        std::cerr << "[ERROR] sendmmsg failed: " << std::strerror(errno)
+                  << std::endl;
+      sent = 0;
+    }
+    for (std::size_t i = static_cast<std::size_t>(sent); i < count; ++i)
+      sendNow(shard,
+              std::make_shared<PendingSend>(std::move(batch[offset + i])));
+    offset += count;
+  }
+#endif
+  batch.clear();
+}
+
+/**
+ * @brief Run the network service until stopped.
+ *
+ * Every shard but the first gets a thread of its own; the calling thread
+ * serves shard 0 along with the signal handler and the timers. The shard
+ * threads are stopped and joined before returning.
+ */
 void ServerNetworkManager::run() {
   checkSignals();
+  for (std::size_t i = 1; i < _shards.size(); ++i) {
+    Shard *shard = _shards[i].get();
+    _shardThreads.emplace_back([shard]() {
+      _currentShard = shard;
+      auto work = asio::make_work_guard(shard->io_context);
+      shard->io_context.run();
+    });
+  }
+  _currentShard = _shards.front().get();
   _io_context.run();
+  stopShardThreads();
+}
+
+/**
+ * @brief Stop the io_contexts of shards 1..K-1, join their threads and close
+ * their sockets, which nothing touches any more once the threads are gone.
+ */
+void ServerNetworkManager::stopShardThreads() {
+  for (std::size_t i = 1; i < _shards.size(); ++i)
+    _shards[i]->io_context.stop();
+  for (auto &thread : _shardThreads) {
+    if (thread.joinable())
+      thread.join();
+  }
+  _shardThreads.clear();
+  for (std::size_t i = 1; i < _shards.size(); ++i) {
+    asio::error_code ec;
+    _shards[i]->socket.close(ec);
+  }
 }
 
 void ServerNetworkManager::sendToAll(const char *data, std::size_t size) {
-  auto buffer = std::make_shared<std::vector<std::uint8_t>>(data, data + size);
-  sendToAll(buffer);
+  sendToAll(_sendBuffers.acquire(data, size));
 }
 
 void ServerNetworkManager::sendToAll(
     std::shared_ptr<std::vector<std::uint8_t>> buffer) {
-  std::shared_ptr<std::vector<std::uint8_t>> data = buffer;
-  if (buffer->size() > COMPRESSION_THRESHOLD) {
-    auto compressed = compression::Compressor::compress(*buffer);
-    if (compression::Compressor::isCompressed(compressed)) {
-      data = std::make_shared<std::vector<std::uint8_t>>(compressed);
-    }
-  }
+  auto data = prepareForWire(std::move(buffer));
 
-  for (const auto &[id, endpoint] : _clientEndpoints) {
-    _socket.async_send_to(asio::buffer(*data), endpoint,
-                          [data](const asio::error_code &error, std::size_t) {
-                            if (error)
-                              std::cerr << "[ERROR] Broadcast failed: "
-                                        << error.message() << std::endl;
-                          });
+  std::shared_lock<std::shared_mutex> lock(_clientRoutesMutex);
+  for (const auto &[id, route] : _clientRoutes) {
+    sendTo(route, data);
   }
 }
 
@@ -139,7 +683,8 @@ void ServerNetworkManager::checkSignals() {
  * Sets the manager as not running, cancels signal handlers and any active
  * timers, closes the network socket, and invokes the optional stop callback if
  * provided. If the manager is already stopped, this function returns without
- * performing any actions.
+ * performing any actions. The other shards' io_contexts are stopped; their
+ * sockets are closed by stopShardThreads() once their threads are joined.
  */
 void ServerNetworkManager::stop() {
   if (!_isRunning.load()) {
@@ -165,6 +710,8 @@ void ServerNetworkManager::stop() {
   }
 
   closeSocket();
+  for (std::size_t i = 1; i < _shards.size(); ++i)
+    _shards[i]->io_context.stop();
 
   if (_stopCallback) {
     _stopCallback();
@@ -183,27 +730,110 @@ void ServerNetworkManager::stop() {
  * Receive errors other than `asio::error::operation_aborted` are logged as
  * warnings when the manager is running.
  *
+ * In batched mode (Linux), the socket is instead waited on for readability
+ * and each wakeup drains up to RECV_BATCH_SIZE datagrams with one recvmmsg
+ * call (see receiveBatch()).
+ *
  * @param callback Function invoked for each received packet; receives a pointer
  * to the data buffer and the number of bytes received.
  */
 void ServerNetworkManager::startReceive(
     const std::function<void(const char *, std::size_t)> &callback) {
-  _socket.async_receive_from(
-      asio::buffer(_recv_buffer), _remote_endpoint,
-      [this, callback](const asio::error_code &error,
-                       std::size_t bytes_transferred) {
+  for (auto &shard : _shards)
+    startReceive(*shard, callback);
+}
+
+/**
+ * @brief Keep receiving on one shard's socket; see the public overload.
+ */
+void ServerNetworkManager::startReceive(
+    Shard &shard,
+    const std::function<void(const char *, std::size_t)> &callback) {
+  if (_batchedIo) {
+    shard.socket.async_wait(
+        asio::ip::udp::socket::wait_read,
+        [this, &shard, callback](const asio::error_code &error) {
+          if (!error) {
+            receiveBatch(shard, callback);
+          } else if (error != asio::error::operation_aborted) {
+            if (_isRunning.load())
+              std::cerr << "[WARNING] Receive failed: " << error.message()
+                        << std::endl;
+          }
+          if (_isRunning.load() && shard.socket.is_open())
+            startReceive(shard, callback);
+        });
+    return;
+  }
+  shard.socket.async_receive_from(
+      asio::buffer(shard.recv_buffer), shard.remote_endpoint,
+      [this, &shard, callback](const asio::error_code &error,
+                               std::size_t bytes_transferred) {
         if (!error && bytes_transferred > 0) {
-          callback(_recv_buffer.data(), bytes_transferred);
+          callback(shard.recv_buffer.data(), bytes_transferred);
         } else if (error && error != asio::error::operation_aborted) {
           if (_isRunning.load())
             std::cerr << "[WARNING] Receive failed: " << error.message()
                       << std::endl;
         }
-        if (_isRunning.load() && _socket.is_open())
-          startReceive(callback);
+        if (_isRunning.load() && shard.socket.is_open())
+          startReceive(shard, callback);
       });
 }
 
+/**
+ * @brief Drain up to RECV_BATCH_SIZE pending datagrams from a shard's socket
+ * with a single recvmmsg call and hand each one to `callback`.
+ *
+ * Before each callback the shard's remote endpoint is set to the datagram's
+ * sender, so getRemoteEndpoint() keeps working as in the one-datagram path.
+ * Replies queued by the callbacks are flushed with sendmmsg once the whole
+ * batch has been handled.
+ *
+ * @param shard Shard whose socket is readable.
+ * @param callback Function invoked for each received datagram.
+ */
+void ServerNetworkManager::receiveBatch(
+    Shard &shard,
+    const std::function<void(const char *, std::size_t)> &callback) {
+#ifdef __linux__
+  for (std::size_t i = 0; i < RECV_BATCH_SIZE; ++i) {
+    shard.recv_iovecs[i].iov_base = shard.recv_buffers[i].data();
+    shard.recv_iovecs[i].iov_len = shard.recv_buffers[i].size();
+    std::memset(&shard.recv_headers[i], 0, sizeof(mmsghdr));
+    shard.recv_headers[i].msg_hdr.msg_name = &shard.recv_addresses[i];
+    shard.recv_headers[i].msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+    shard.recv_headers[i].msg_hdr.msg_iov = &shard.recv_iovecs[i];
+    shard.recv_headers[i].msg_hdr.msg_iovlen = 1;
+  }
+
+  const int received =
+      ::recvmmsg(shard.socket.native_handle(), shard.recv_headers.data(),
+                 static_cast<unsigned int>(RECV_BATCH_SIZE), MSG_DONTWAIT,
+                 nullptr);
+  if (received < 0) {
+    if (errno != EAGAIN && errno != EWOULDBLOCK && _isRunning.load())
+      std::cerr << "[WARNING] recvmmsg failed: " << std::strerror(errno)
+                << std::endl;
+    return;
+  }
+
+  for (int i = 0; i < received; ++i) {
+    const auto length = shard.recv_headers[i].msg_len;
+    if (length == 0)
+      continue;
+    std::memcpy(shard.remote_endpoint.data(), &shard.recv_addresses[i],
+                shard.recv_headers[i].msg_hdr.msg_namelen);
+    shard.remote_endpoint.resize(shard.recv_headers[i].msg_hdr.msg_namelen);
+    callback(shard.recv_buffers[i].data(), length);
+  }
+  flushSends(shard);
+#else
+  (void)shard;
+  (void)callback;
+#endif
+}
+
 /**
  * @brief Schedules a recurring event-processing callback to run at the given
  * interval.
@@ -1,29 +1,133 @@
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <csignal>
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
 #include <unordered_map>
+#include <vector>
+#include "AckChannel.hpp"
 #include "BaseNetworkManager.hpp"
+#include "TokenBucket.hpp"
+
+#ifdef __linux__
+  #include <sys/socket.h>
+  #include <sys/uio.h>
+#endif
 
 namespace network {
 
+  /**
+   * @brief Packets waiting to leave for one client in a single datagram (a
+   * PacketBundle), for clients that negotiated aggregation.
+   *
+   * `mtu` stays 0, which sends every packet on its own, until aggregation is
+   * enabled. Afterwards packets are appended to the open bundle, which is
+   * sent at the end of the I/O pass of the client's shard, or as soon as the
+   * next packet would take it past `mtu` bytes. A bundle holding a single
+   * packet is sent as that packet alone.
+   *
+   * `compact` is set for clients that negotiated CAPABILITY_COMPACT: packets
+   * with a compact encoding are sent to them in it.
+   */
+  struct OutboundBundle {
+      std::atomic<std::size_t> mtu{0};
+      std::atomic<bool> compact{false};
+      std::mutex mutex;
+      std::shared_ptr<std::vector<std::uint8_t>> buffer;
+      std::shared_ptr<std::vector<std::uint8_t>> first;
+      std::size_t count = 0;
+      std::uint16_t sequence = 0;
+  };
+
+  /**
+   * @brief Where a client is reached: its endpoint and the shard whose socket
+   * the kernel hashes its 4-tuple to. Fixed once the client is registered,
+   * so it can be cached next to the client.
+   *
+   * `acks` is the connection's reliability state, `outbound` its
+   * aggregation queue and `budget` its send rate budget, all shared by every
+   * copy of the route; each datagram sent along the route is stamped from
+   * `acks` and charged to `budget`.
+   */
+  struct ClientRoute {
+      asio::ip::udp::endpoint endpoint;
+      std::size_t shard = 0;
+      std::shared_ptr<AckChannel> acks;
+      std::shared_ptr<OutboundBundle> outbound;
+      std::shared_ptr<TokenBucket> budget;
+  };
+
+  /**
+   * @brief Hash of a UDP endpoint (address and port), to key hash maps by
+   * client endpoint.
+   */
+  struct EndpointHash {
+      std::size_t operator()(const asio::ip::udp::endpoint &endpoint) const {
+        std::size_t seed = std::hash<unsigned short>()(endpoint.port());
+        if (endpoint.address().is_v4()) {
+          seed ^= std::hash<std::uint32_t>()(
+                      endpoint.address().to_v4().to_uint()) +
+                  0x9e3779b9 + (seed << 6) + (seed >> 2);
+        } else {
+          for (auto byte : endpoint.address().to_v6().to_bytes())
+            seed ^= byte + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        }
+        return seed;
+      }
+  };
+
   class ServerNetworkManager : public BaseNetworkManager {
     public:
-      explicit ServerNetworkManager(std::uint16_t port);
+      explicit ServerNetworkManager(std::uint16_t port, bool batched_io = true,
+                                    std::size_t socket_count = 1);
+      ~ServerNetworkManager() override;
+
+      using BaseNetworkManager::getIoContext;
 
       void startReceive(const std::function<void(const char *, std::size_t)>
                             &callback) override;
       void send(const char *data, std::size_t size) override;
       void send(std::shared_ptr<std::vector<std::uint8_t>> buffer) override;
 
-      void registerClient(int id, const asio::ip::udp::endpoint &endpoint);
+      ClientRoute registerClient(int id,
+                                 const asio::ip::udp::endpoint &endpoint);
       void unregisterClient(int id);
 
       void sendToClient(int id, const char *data, std::size_t size);
       void sendToClient(int id,
                         std::shared_ptr<std::vector<std::uint8_t>> buffer);
+      static std::shared_ptr<std::vector<std::uint8_t>> prepareForWire(
+          std::shared_ptr<std::vector<std::uint8_t>> buffer);
+      std::uint16_t sendPrepared(
+          const ClientRoute &route,
+          std::shared_ptr<std::vector<std::uint8_t>> buffer);
+      void flushAcks(const ClientRoute &route);
+      bool enableAggregation(const ClientRoute &route);
+      bool enableCompactEncoding(const ClientRoute &route);
+
+      /**
+       * @brief Size cap of the datagrams bundling several packets, ack
+       * header included; 0 turns aggregation off for every client.
+       */
+      void setAggregationMtu(std::size_t mtu) {
+        _aggregationMtu = mtu;
+      }
+
+      /**
+       * @brief Bytes per second each client registered from now on may be
+       * sent before deferrable updates are held back; 0 means unlimited.
+       */
+      void setClientSendRate(std::size_t rate) {
+        _clientSendRate = rate;
+      }
+
       void sendToAll(const char *data, std::size_t size);
       void sendToAll(std::shared_ptr<std::vector<std::uint8_t>> buffer);
 
@@ -80,27 +184,141 @@ namespace network {
        * @throws std::out_of_range If no endpoint is registered for `player_id`.
        */
       asio::ip::udp::endpoint getClientEndpoint(std::uint32_t player_id) {
-        return _clientEndpoints.at(player_id);
+        std::shared_lock<std::shared_mutex> lock(_clientRoutesMutex);
+        return _clientRoutes.at(player_id).endpoint;
       }
 
+      /**
+       * @brief Sender of the datagram being handled on the calling thread's
+       * socket.
+       */
       asio::ip::udp::endpoint getRemoteEndpoint() {
-        return _remote_endpoint;
+        return currentShard().remote_endpoint;
+      }
+
+      /**
+       * @brief Number of sockets sharing the port, each served by its own
+       * io_context thread.
+       */
+      std::size_t getSocketCount() const {
+        return _shards.size();
+      }
+
+      std::size_t getCurrentShard();
+      std::size_t getClientShard(int id) const;
+      asio::io_context &getIoContext(std::size_t shard);
+      void post(std::size_t shard, std::function<void()> task);
+
+      /**
+       * @brief Tell whether datagrams are received with recvmmsg and sent
+       * with sendmmsg. Always false outside Linux.
+       */
+      bool isBatchedIo() const {
+        return _batchedIo;
       }
 
     private:
-      asio::ip::udp::endpoint _remote_endpoint;
+      /**
+       * @brief A datagram waiting to be sent: its ack header and the payload
+       * that follows it. The buffer is kept alive until the kernel has
+       * copied it.
+       */
+      struct PendingSend {
+          asio::ip::udp::endpoint endpoint;
+          std::shared_ptr<std::vector<std::uint8_t>> buffer;
+          std::array<std::uint8_t, ACK_HEADER_SIZE> ack_header{};
+      };
+
+      /**
+       * @brief One SO_REUSEPORT socket with the io_context that serves it.
+       *
+       * Shard 0 wraps the base class socket and io_context, which also run
+       * the timers; the others own theirs and run on a thread of their own.
+       * Everything in a shard is only touched from its thread, except the
+       * send queue, which is guarded by `send_mutex`.
+       */
+      struct Shard {
+          Shard(std::size_t shard_index, asio::io_context &context,
+                asio::ip::udp::socket &udp_socket)
+              : index(shard_index), io_context(context), socket(udp_socket) {
+          }
+
+          std::size_t index;
+          std::unique_ptr<asio::io_context> owned_io_context;
+          std::unique_ptr<asio::ip::udp::socket> owned_socket;
+          asio::io_context &io_context;
+          asio::ip::udp::socket &socket;
+          asio::ip::udp::endpoint remote_endpoint;
+          std::array<char, BUFFER_SIZE> recv_buffer;
+          std::mutex send_mutex;
+          std::vector<PendingSend> send_queue;
+          std::vector<PendingSend> send_batch;
+          bool flush_scheduled = false;
+#ifdef __linux__
+          std::array<std::array<char, BUFFER_SIZE>, RECV_BATCH_SIZE>
+              recv_buffers;
+          std::array<sockaddr_storage, RECV_BATCH_SIZE> recv_addresses;
+          std::array<iovec, RECV_BATCH_SIZE> recv_iovecs;
+          std::array<mmsghdr, RECV_BATCH_SIZE> recv_headers;
+          std::array<iovec, 2 * SEND_BATCH_SIZE> send_iovecs;
+          std::array<mmsghdr, SEND_BATCH_SIZE> send_headers;
+#endif
+      };
+
+      void openShards(std::uint16_t port, std::size_t socket_count);
+      void prepareSocket(asio::ip::udp::socket &socket, std::uint16_t port,
+                         bool reuse_port);
+      Shard &currentShard();
+      void stopShardThreads();
+
+      void startReceive(
+          Shard &shard,
+          const std::function<void(const char *, std::size_t)> &callback);
+      void receiveBatch(
+          Shard &shard,
+          const std::function<void(const char *, std::size_t)> &callback);
+      std::uint16_t sendTo(const ClientRoute &route,
+                           std::shared_ptr<std::vector<std::uint8_t>> buffer,
+                           const void *source = nullptr);
+      std::uint16_t sendBundled(
+          Shard &shard, const ClientRoute &route, std::size_t mtu,
+          std::shared_ptr<std::vector<std::uint8_t>> buffer,
+          const void *source);
+      std::uint16_t sendFragmented(
+          Shard &shard, const ClientRoute &route,
+          const std::shared_ptr<std::vector<std::uint8_t>> &buffer,
+          const void *source);
+      void closeBundle(Shard &shard, const ClientRoute &route);
+      PendingSend takeBundle(const ClientRoute &route);
+      std::shared_ptr<std::vector<std::uint8_t>> toCompact(
+          const std::shared_ptr<std::vector<std::uint8_t>> &buffer);
+      void dispatch(Shard &shard, PendingSend pending);
+      void sendNow(Shard &shard, std::shared_ptr<PendingSend> pending);
+      void flushSends(Shard &shard);
+
+      static thread_local Shard *_currentShard;
+
       asio::signal_set _signals;
       std::shared_ptr<asio::steady_timer> _eventTimer;
       std::shared_ptr<asio::steady_timer> _timeoutTimer;
       std::shared_ptr<asio::steady_timer> _unacknowledgedTimer;
       std::shared_ptr<asio::steady_timer> _clearSeqTimer;
-      std::unordered_map<int, asio::ip::udp::endpoint> _clientEndpoints;
+      std::unordered_map<int, ClientRoute> _clientRoutes;
+      mutable std::shared_mutex _clientRoutesMutex;
       std::function<void()> _stopCallback;
       std::atomic<bool> _isRunning;
       bool _unacknowledgedScheduled = false;
       bool _timeoutScheduled = false;
       bool _eventScheduled = false;
       bool _clearSeqScheduled = false;
+
+
+      bool _batchedIo;
+      std::size_t _aggregationMtu = AGGREGATION_MTU;
+      std::size_t _clientSendRate = CLIENT_SEND_RATE;
+      std::atomic<std::uint16_t> _nextFragmentedMessage{0};
+      std::vector<std::unique_ptr<Shard>> _shards;
+      std::vector<std::thread> _shardThreads;
   };
 
 }  // namespace network
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "Macro.hpp"
+
+namespace network {
+
+  /**
+   * @brief Hashed timer wheel: RESEND_WHEEL_SLOTS slots of
+   * RESEND_WHEEL_TICK_MS each, holding values until their deadline.
+   *
+   * Scheduling is O(1); advancing only visits the slots of the ticks that
+   * elapsed, so a periodic check no longer scans every pending entry.
+   * Deadlines further than one turn of the wheel stay in their slot until the
+   * turn they fall in.
+   *
+   * Entries cannot be cancelled: the owner checks on expiry whether the value
+   * is still due, and drops it otherwise. Not synchronized.
+   */
+  template <typename T>
+  class TimerWheel {
+    public:
+      using Clock = std::chrono::steady_clock;
+
+      explicit TimerWheel(Clock::time_point start = Clock::now())
+          : _start(start) {
+      }
+
+      /**
+       * @brief Hold `value` until `deadline`; deadlines already passed
+       * expire on the next advance().
+       */
+      void schedule(Clock::time_point deadline, T value) {
+        std::uint64_t tick = toTick(deadline);
+        if (tick <= _currentTick)
+          tick = _currentTick + 1;
+        _slots[tick % RESEND_WHEEL_SLOTS].push_back({tick, std::move(value)});
+        ++_size;
+      }
+
+      /**
+       * @brief Call `onExpired(value)` for every value whose deadline is at
+       * or before `now`, tick by tick. `onExpired` may schedule new
+       * values; they expire on a later advance().
+       */
+      template <typename Func>
+      void advance(Clock::time_point now, Func &&onExpired) {
+        const std::uint64_t target = toTick(now);
+        if (target <= _currentTick)
+          return;
+        const std::uint64_t first =
+            target - _currentTick > RESEND_WHEEL_SLOTS
+                ? target - RESEND_WHEEL_SLOTS + 1
+                : _currentTick + 1;
+        _currentTick = target;
+        for (std::uint64_t tick = first; tick <= target; ++tick) {
+          auto &slot = _slots[tick % RESEND_WHEEL_SLOTS];
+          if (slot.empty())
+            continue;
+          std::vector<Entry> due;
+          for (std::size_t i = 0; i < slot.size();) {
+            if (slot[i].tick <= target) {
+              due.push_back(std::move(slot[i]));
+              slot[i] = std::move(slot.back());
+              slot.pop_back();
+            } else {
+              ++i;
+            }
+          }
+          _size -= due.size();
+          for (auto &entry : due)
+            onExpired(entry.value);
+        }
+      }
+
+      std::size_t size() const {
+        return _size;
+      }
+
+      void clear() {
+        for (auto &slot : _slots)
+          slot.clear();
+        _size = 0;
+      }
+
+    private:
+      struct Entry {
+          std::uint64_t tick;
+          T value;
+      };
+
+      std::uint64_t toTick(Clock::time_point time) const {
+        if (time <= _start)
+          return 0;
+        return static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(time -
+                                                                  _start)
+                .count() /
+            RESEND_WHEEL_TICK_MS);
+      }
+
+      Clock::time_point _start;
+      std::uint64_t _currentTick = 0;
+      std::size_t _size = 0;
+      std::array<std::vector<Entry>, RESEND_WHEEL_SLOTS> _slots;
+  };
+
+}  // namespace network
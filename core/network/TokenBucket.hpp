@@ -0,0 +1,84 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+
+namespace network {
+
+  /**
+   * @brief Byte budget of one connection: `rate` bytes per second, of which
+   * up to `burst` can be saved up.
+   *
+   * Every byte sent is charged, even when that takes the bucket below zero:
+   * reliable traffic is never held back, it leaves less room to what can
+   * wait. Senders of deferrable traffic check available() first. A rate of 0
+   * means unlimited.
+   *
+   * Sends happen on several threads, so every call takes the bucket's
+   * mutex.
+   */
+  class TokenBucket {
+    public:
+      using Clock = std::chrono::steady_clock;
+
+      TokenBucket(std::size_t rate = 0, std::size_t burst = 0)
+          : _rate(rate),
+            _burst(static_cast<std::int64_t>(burst)),
+            _tokens(static_cast<std::int64_t>(burst)),
+            _lastRefill(Clock::now()) {
+      }
+
+      /**
+       * @brief Charge `bytes` sent; the balance may go negative, down to
+       * -burst.
+       */
+      void consume(std::size_t bytes) {
+        if (_rate == 0)
+          return;
+        std::lock_guard<std::mutex> lock(_mutex);
+        refillLocked(Clock::now());
+        _tokens = std::max(_tokens - static_cast<std::int64_t>(bytes), -_burst);
+      }
+
+      /**
+       * @brief Bytes that can be sent right now without exceeding the rate;
+       * negative while earlier sends are still being paid off.
+       */
+      std::int64_t available() {
+        if (_rate == 0)
+          return std::numeric_limits<std::int64_t>::max();
+        std::lock_guard<std::mutex> lock(_mutex);
+        refillLocked(Clock::now());
+        return _tokens;
+      }
+
+      bool unlimited() const {
+        return _rate == 0;
+      }
+
+    private:
+      void refillLocked(Clock::time_point now) {
+        const auto elapsed =
+            std::chrono::duration_cast<std::chrono::microseconds>(now -
+                                                                  _lastRefill)
+                .count();
+        const std::int64_t earned =
+            elapsed * static_cast<std::int64_t>(_rate) / 1000000;
+        if (earned <= 0)
+          return;
+        _tokens = std::min(_tokens + earned, _burst);
+        _lastRefill = now;
+      }
+
+      const std::size_t _rate;
+      const std::int64_t _burst;
+      std::mutex _mutex;
+      std::int64_t _tokens;
+      Clock::time_point _lastRefill;
+  };
+
+}  // namespace network
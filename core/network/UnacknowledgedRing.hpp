@@ -0,0 +1,137 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include "Macro.hpp"
+#include "PacketUtils.hpp"
+
+namespace network {
+
+  /**
+   * @brief Reliable packets of one connection awaiting acknowledgement, in a
+   * fixed ring of UNACKNOWLEDGED_RING_SIZE slots.
+   *
+   * Each tracked packet gets the next tracking number of the connection and
+   * lives in slot `number % UNACKNOWLEDGED_RING_SIZE`, so insert, lookup and
+   * erase are O(1) with no hashing or allocation. Tracking numbers rather
+   * than packet sequence numbers index the ring: the latter come from room
+   * counters and are not monotonic per connection.
+   *
+   * Pending packets all lie between the oldest pending cursor and the next
+   * tracking number; scans start at the cursor and stop once every pending
+   * packet was visited. When a packet is inserted into a slot still holding
+   * a packet UNACKNOWLEDGED_RING_SIZE numbers older, that packet is given up,
+   * as if it had run out of retransmissions.
+   *
+   * Not synchronized: the owner guards it with the lock of its retransmit
+   * queue.
+   */
+  class UnacknowledgedRing {
+    public:
+      /**
+       * @brief Track `packet` until it is erased.
+       *
+       * @return std::uint32_t Tracking number of the packet, for find() and
+       * erase().
+       */
+      std::uint32_t insert(UnacknowledgedPacket packet) {
+        const std::uint32_t number = _next++;
+        Slot &slot = _slots[number % UNACKNOWLEDGED_RING_SIZE];
+        if (slot.pending)
+          release(slot);
+        slot.pending = true;
+        slot.number = number;
+        slot.packet = std::move(packet);
+        ++_pending;
+        advanceOldest();
+        return number;
+      }
+
+      /**
+       * @brief Packet tracked under `number`, or nullptr once it was erased
+       * (acknowledged, given up or evicted).
+       */
+      UnacknowledgedPacket *find(std::uint32_t number) {
+        Slot &slot = _slots[number % UNACKNOWLEDGED_RING_SIZE];
+        if (!slot.pending || slot.number != number)
+          return nullptr;
+        return &slot.packet;
+      }
+
+      void erase(std::uint32_t number) {
+        Slot &slot = _slots[number % UNACKNOWLEDGED_RING_SIZE];
+        if (!slot.pending || slot.number != number)
+          return;
+        release(slot);
+        advanceOldest();
+      }
+
+      /**
+       * @brief Erase every pending packet for which `predicate(packet)`
+       * returns true, visiting them from the oldest.
+       */
+      template <typename Predicate>
+      void eraseIf(Predicate &&predicate) {
+        std::size_t remaining = _pending;
+        for (std::uint32_t number = _oldest; remaining > 0; ++number) {
+          Slot &slot = _slots[number % UNACKNOWLEDGED_RING_SIZE];
+          if (!slot.pending)
+            continue;
+          --remaining;
+          if (predicate(slot.packet))
+            release(slot);
+        }
+        advanceOldest();
+      }
+
+      std::size_t size() const {
+        return _pending;
+      }
+
+      void clear() {
+        for (Slot &slot : _slots)
+          if (slot.pending)
+            release(slot);
+        _oldest = _next;
+      }
+
+    private:
+      static_assert((UNACKNOWLEDGED_RING_SIZE &
+                     (UNACKNOWLEDGED_RING_SIZE - 1)) == 0,
+                    "tracking numbers wrap: the ring size must divide 2^32");
+
+      struct Slot {
+          bool pending = false;
+          std::uint32_t number = 0;
+          UnacknowledgedPacket packet{};
+      };
+
+      void release(Slot &slot) {
+        slot.pending = false;
+        slot.packet.data.reset();
+        --_pending;
+      }
+
+      /**
+       * @brief Move the oldest pending cursor past released slots.
+       */
+      void advanceOldest() {
+        if (_pending == 0) {
+          _oldest = _next;
+          return;
+        }
+        if (_next - _oldest > UNACKNOWLEDGED_RING_SIZE)
+          _oldest = _next - UNACKNOWLEDGED_RING_SIZE;
+        while (!_slots[_oldest % UNACKNOWLEDGED_RING_SIZE].pending)
+          ++_oldest;
+      }
+
+      std::array<Slot, UNACKNOWLEDGED_RING_SIZE> _slots{};
+      std::uint32_t _next = 0;
+      std::uint32_t _oldest = 0;
+      std::size_t _pending = 0;
+  };
+
+}  // namespace network
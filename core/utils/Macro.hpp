@@ -36,23 +36,63 @@ constexpr int MARGIN_WINDOW = 30;
 constexpr int COUNTDOWN_TIME = 5;
 constexpr float GAME_DURATION = 20.0f;
 constexpr int TPS = 20;
+constexpr std::size_t PROJECTILE_POOL_SIZE = 64;
+constexpr std::size_t ENEMY_POOL_SIZE = 16;
 
 constexpr int PING_INTERVAL_CLIENT = 50;
+constexpr int INPUT_SEND_INTERVAL_CLIENT = 1000 / TPS;  // one input per tick
+constexpr std::size_t INPUT_REDUNDANCY = 16;  // ticks repeated per packet
+constexpr std::size_t MAX_INPUT_RUNS = INPUT_REDUNDANCY;
+constexpr std::size_t INPUT_CATCH_UP_STEPS = 2;  // extra inputs after a gap
+constexpr std::uint32_t INPUT_JITTER_TICKS = 5;  // input tick lead tolerated
+
+/* Lag compensation */
+constexpr std::size_t POSITION_HISTORY_SIZE = 32;  // ticks kept per entity
+constexpr std::uint32_t MAX_LAG_COMPENSATION_MS = 500;
 
 /* Network/Protocol */
 constexpr std::size_t BUFFER_SIZE = 2048;
+constexpr std::size_t RECV_BATCH_SIZE = 32;  // datagrams per recvmmsg
+constexpr std::size_t SEND_BATCH_SIZE = 64;  // datagrams per sendmmsg
+constexpr std::size_t SEND_BUFFER_POOL_SIZE = 1024;  // pooled send buffers
+constexpr std::size_t SEND_BUFFER_CAPACITY = BUFFER_SIZE;
+constexpr std::size_t ACK_HEADER_SIZE = 8;  // reliability header per datagram
+constexpr std::uint32_t ACK_BITS = 32;      // older datagrams acked per header
+constexpr std::size_t ACK_SEND_HISTORY = 64;  // sent packets remembered
+constexpr std::size_t AGGREGATION_MTU = 1200;  // default bundled datagram size
+constexpr std::size_t AGGREGATION_HEADER_SIZE = 4;
+constexpr std::size_t AGGREGATION_LENGTH_SIZE = 2;  // size prefix per packet
+constexpr std::uint8_t CAPABILITY_AGGREGATION = 1 << 0;  // PlayerInfo flag
+constexpr std::uint8_t CAPABILITY_COMPACT = 1 << 1;  // PlayerInfo flag
+constexpr std::size_t CLIENT_SEND_RATE = 32768;  // bytes/s per client
+constexpr int SEND_BUDGET_BURST_MS = 250;  // rate saved up while idle
 constexpr std::uint32_t NO_ROOM = std::numeric_limits<std::uint32_t>::max();
-constexpr int RESEND_PACKET_DELAY = 500;  // number in milliseconds
+constexpr std::size_t NO_CLIENT_SLOT = std::numeric_limits<std::size_t>::max();
+constexpr int RESEND_WHEEL_TICK_MS = 10;  // retransmission timer resolution
+constexpr std::size_t RESEND_WHEEL_SLOTS = 256;  // one turn spans 2.56 s
 constexpr int MAX_RESEND_ATTEMPTS = 5;
-constexpr int MIN_RESEND_PACKET_DELAY = 200;
+constexpr std::size_t UNACKNOWLEDGED_RING_SIZE = 512;  // in flight per peer
+constexpr int INITIAL_RTO_MS = 200;  // before the first RTT sample
+constexpr int MIN_RTO_MS = 20;
+constexpr int MAX_RTO_MS = 2000;
+constexpr int ACK_FLUSH_DELAY_MS = 1000 / TPS;  // let traffic carry acks
+constexpr std::size_t FRAGMENT_MTU = AGGREGATION_MTU;  // larger are split
+constexpr std::size_t FRAGMENT_HEADER_SIZE = 8;
+constexpr std::size_t FRAGMENT_PAYLOAD_SIZE =
+    FRAGMENT_MTU - ACK_HEADER_SIZE - FRAGMENT_HEADER_SIZE;
+constexpr std::size_t MAX_FRAGMENTS = 32;  // per packet, one ack bit each
+constexpr std::size_t REASSEMBLY_BUDGET =
+    4 * MAX_FRAGMENTS * FRAGMENT_PAYLOAD_SIZE;  // partial packets per peer
+constexpr int REASSEMBLY_TIMEOUT_MS = MAX_RTO_MS;
+constexpr std::size_t REASSEMBLY_HISTORY = 16;  // completed ids remembered
 constexpr int MAX_ROOMS = 10;
+constexpr std::size_t GAME_POOL_SIZE = MAX_ROOMS;  // idle games kept for reuse
 constexpr int CHALLENGE_HEX_LEN = 129;
 constexpr std::uint32_t INVALID_ID = std::numeric_limits<std::uint32_t>::max();
 constexpr std::uint32_t INVALID_ENTITY =
     std::numeric_limits<std::uint32_t>::max();
 constexpr std::uint32_t SERVER_SENDER_ID =
     std::numeric_limits<std::uint32_t>::max();
-constexpr std::uint32_t SCOREBOARD_MAX_ENTRIES = 100;
 constexpr std::uint32_t MAX_TOP_SCORES = 1000;
 constexpr const char *SQL_PATH = "db.sql";
 constexpr int NANOSECONDS_IN_SECOND = 1000000000;
@@ -88,5 +128,9 @@ constexpr unsigned char ASCII_DEL = 0x7f;
 constexpr int OK = 0;
 constexpr int KO = -1;
 
-constexpr int COMPRESSION_THRESHOLD = 150;
-static constexpr int HEADER_SIZE_LZ4 = 12;
+constexpr std::uint8_t COMPRESSED_PACKET_MARKER = 0xC0;  // not a PacketType
+constexpr std::size_t MAX_COMPRESSED_HEADER_SIZE = 4;  // marker + 3B varint
+constexpr std::size_t COMPRESSION_MIN_SIZE = 16;  // smaller never shrinks
+constexpr std::uint8_t COMPACT_PACKET_FLAG = 0x80;  // v2 encoding, tag byte
+constexpr std::uint8_t COMPACT_FULL_SEQUENCE_FLAG = 0x40;  // varint sequence
+constexpr std::uint8_t COMPACT_TYPE_MASK = 0x3F;  // PacketType in tag byte
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <utility>
+#include <vector>
+#include "Macro.hpp"
+
+namespace ecs {
+
+  /**
+   * @brief Compact reference to a value stored in a SlotMap: the slot index
+   * and the generation the slot had when the value was inserted.
+   */
+  struct SlotHandle {
+      std::uint32_t index = INVALID_ID;
+      std::uint32_t generation = 0;
+  };
+
+  /**
+   * @brief Flat, generation-checked container handing out SlotHandle keys.
+   *
+   * Values are stored inline in slots; a lookup is a bounds check, a
+   * generation check and an index. Erasing a value bumps the slot's
+   * generation, so handles to it go stale instead of reaching whatever is
+   * stored there next, and pushes the slot on a free list reused by the next
+   * insertion.
+   *
+   * Slots live in a deque, so inserting never moves existing values and
+   * pointers returned by get() stay valid for the container's lifetime. An
+   * erased value is kept in place until its slot is reused.
+   */
+  template <typename T>
+  class SlotMap {
+    public:
+      /**
+       * @brief Construct a value in a free slot, or in a new slot when none
+       * is free.
+       *
+       * @return SlotHandle Handle to the inserted value.
+       */
+      template <typename... Args>
+      SlotHandle emplace(Args &&...args) {
+        std::uint32_t index;
+        if (!_free.empty()) {
+          index = _free.back();
+          _free.pop_back();
+        } else {
+          index = static_cast<std::uint32_t>(_slots.size());
+          _slots.emplace_back();
+        }
+        Slot &slot = _slots[index];
+        slot.value.emplace(std::forward<Args>(args)...);
+        slot.occupied = true;
+        ++_size;
+        return {index, slot.generation};
+      }
+
+      /**
+       * @brief Erase the value referenced by `handle`.
+       *
+       * @return true if the handle was live, false if it was stale.
+       */
+      bool erase(SlotHandle handle) {
+        if (!contains(handle))
+          return false;
+        Slot &slot = _slots[handle.index];
+        slot.occupied = false;
+        ++slot.generation;
+        _free.push_back(handle.index);
+        --_size;
+        return true;
+      }
+
+      bool contains(SlotHandle handle) const {
+        return handle.index < _slots.size() &&
+               _slots[handle.index].occupied &&
+               _slots[handle.index].generation == handle.generation;
+      }
+
+      /**
+       * @brief Resolve a handle.
+       *
+       * @return T* The value, or `nullptr` if the handle is stale.
+       */
+      T *get(SlotHandle handle) {
+        return contains(handle) ? &*_slots[handle.index].value : nullptr;
+      }
+
+      const T *get(SlotHandle handle) const {
+        return contains(handle) ? &*_slots[handle.index].value : nullptr;
+      }
+
+      /**
+       * @brief Call `func(handle, value)` for every live value, in slot
+       * order.
+       */
+      template <typename Func>
+      void forEach(Func &&func) {
+        for (std::uint32_t i = 0; i < _slots.size(); ++i) {
+          if (_slots[i].occupied)
+            func(SlotHandle{i, _slots[i].generation}, *_slots[i].value);
+        }
+      }
+
+      template <typename Func>
+      void forEach(Func &&func) const {
+        for (std::uint32_t i = 0; i < _slots.size(); ++i) {
+          if (_slots[i].occupied)
+            func(SlotHandle{i, _slots[i].generation}, *_slots[i].value);
+        }
+      }
+
+      std::size_t size() const {
+        return _size;
+      }
+
+      bool empty() const {
+        return _size == 0;
+      }
+
+      /**
+       * @brief Erase every value. Slots are kept with bumped generations, so
+       * all outstanding handles go stale.
+       */
+      void clear() {
+        _free.clear();
+        for (std::uint32_t i = static_cast<std::uint32_t>(_slots.size());
+             i-- > 0;) {
+          if (_slots[i].occupied) {
+            _slots[i].occupied = false;
+            ++_slots[i].generation;
+          }
+          _free.push_back(i);
+        }
+        _size = 0;
+      }
+
+    private:
+      struct Slot {
+          std::optional<T> value;
+          std::uint32_t generation = 0;
+          bool occupied = false;
+      };
+
+      std::deque<Slot> _slots;
+      std::vector<std::uint32_t> _free;
+      std::size_t _size = 0;
+  };
+
+}  // namespace ecs
@@ -2,6 +2,7 @@
 
 #include "Macro.hpp"
 #include "Packet.hpp"
+#include "SlotMap.hpp"
 
 namespace ecs {
 
@@ -9,5 +10,6 @@ namespace ecs {
       int enemy_id = INVALID_ID;
       EnemyType type = EnemyType::BASIC_FIGHTER;
       bool is_alive = true;
+      SlotHandle handle{};
   };
 }  // namespace ecs
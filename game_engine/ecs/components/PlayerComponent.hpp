@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <string>
+#include "SlotMap.hpp"
 
 namespace ecs {
 
@@ -12,6 +13,7 @@ namespace ecs {
       bool is_alive = true;
       std::uint32_t sequence_number = 0;
       bool connected = false;
+      SlotHandle handle{};
   };
 
 }  // namespace ecs
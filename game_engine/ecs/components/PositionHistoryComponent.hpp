@@ -0,0 +1,69 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include "Macro.hpp"
+
+namespace ecs {
+  /**
+   * @brief Position of an entity at the end of a given server tick.
+   */
+  struct PositionSnapshot {
+      std::uint32_t tick = 0;
+      float x = 0.0f;
+      float y = 0.0f;
+  };
+
+  /**
+   * @brief Bounded history of the last POSITION_HISTORY_SIZE positions of an
+   * entity, used by the server to rewind targets for lag compensation.
+   *
+   * Snapshots are stored inline in a ring buffer, so recording a tick never
+   * allocates. Snapshots are expected to be recorded once per tick, which
+   * makes the lookup of a past tick a direct index computation.
+   */
+  struct PositionHistoryComponent {
+      std::array<PositionSnapshot, POSITION_HISTORY_SIZE> snapshots{};
+      std::uint32_t head = 0;
+      std::uint32_t count = 0;
+
+      /**
+       * @brief Records the position of the entity for the given tick,
+       * overwriting the oldest snapshot once the buffer is full.
+       *
+       * @param tick Server tick the position belongs to.
+       * @param x Position along the X axis.
+       * @param y Position along the Y axis.
+       */
+      void record(std::uint32_t tick, float x, float y) {
+        snapshots[head] = {tick, x, y};
+        head = (head + 1) % POSITION_HISTORY_SIZE;
+        if (count < POSITION_HISTORY_SIZE)
+          ++count;
+      }
+
+      /**
+       * @brief Retrieves the snapshot recorded for the given tick.
+       *
+       * Ticks newer than the latest snapshot resolve to the latest one, ticks
+       * older than the history resolve to the oldest one still stored.
+       *
+       * @param tick Server tick to rewind to.
+       * @return std::optional<PositionSnapshot> The matching snapshot, or
+       * `std::nullopt` if nothing has been recorded yet.
+       */
+      std::optional<PositionSnapshot> at(std::uint32_t tick) const {
+        if (count == 0)
+          return std::nullopt;
+        const std::uint32_t newest =
+            (head + POSITION_HISTORY_SIZE - 1) % POSITION_HISTORY_SIZE;
+        std::uint32_t back =
+            tick >= snapshots[newest].tick ? 0 : snapshots[newest].tick - tick;
+        if (back >= count)
+          back = count - 1;
+        return snapshots[(newest + POSITION_HISTORY_SIZE - back) %
+                         POSITION_HISTORY_SIZE];
+      }
+  };
+}  // namespace ecs
@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include "Packet.hpp"
+#include "SlotMap.hpp"
 
 namespace ecs {
   /*
@@ -18,6 +19,8 @@ namespace ecs {
       float speed = 0.0f;
       std::uint32_t sequence_number = 0;
       std::uint32_t damage;
+      std::uint32_t rewind_ticks = 0;
+      SlotHandle handle{};
   };
 
 }  // namespace ecs
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include "SlotMap.hpp"
 
 namespace ecs {
   struct ShootComponent {
@@ -8,7 +9,7 @@ namespace ecs {
       float shoot_interval = 3.0f;
       bool can_shoot = true;
       float last_shoot_time = 0.0f;
-      std::uint32_t active_projectile_id = 0;
+      SlotHandle active_projectile{};
       bool has_active_projectile = false;
   };
 }  // namespace ecs
@@ -1,7 +1,7 @@
 #include "CollisionSystem.hpp"
+#include <algorithm>
 #include <iostream>
 #include <memory>
-#include <unordered_set>
 #include "ColliderComponent.hpp"
 #include "ECSManager.hpp"
 #include "EnemyComponent.hpp"
@@ -13,6 +13,7 @@
 #include "Player.hpp"
 #include "PlayerComponent.hpp"
 #include "PositionComponent.hpp"
+#include "PositionHistoryComponent.hpp"
 #include "Projectile.hpp"
 #include "ProjectileComponent.hpp"
 #include "ScoreComponent.hpp"
@@ -21,56 +22,40 @@
  * @brief Iterates managed entities and detects/handles axis-aligned
  * bounding-box collisions between all unique pairs.
  *
- * During iteration, entities found out of bounds are destroyed and skipped.
- * Each unordered pair is checked once; entities removed during processing are
- * tracked to avoid further checks. When two existing entities' AABBs overlap,
- * `handleCollision` is invoked; if either entity is removed as a result, it is
- * marked destroyed and further comparisons are adjusted accordingly.
+ * The live colliders are gathered once per update: pooled entities are
+ * skipped and projectiles found out of bounds are destroyed. Each unordered
+ * pair of them is then checked once. When two AABBs overlap,
+ * `handleCollision` is invoked; an entity removed or returned to its pool as
+ * a result is left out of the remaining comparisons.
  *
  * @param dt Elapsed time since the previous update in seconds.
  */
 void ecs::CollisionSystem::update(float dt) {
-  std::vector<Entity> entities;
+  if (!_game || !_eventQueue)
+    return;
   {
     std::lock_guard<std::mutex> lock(_mutex);
-    entities.assign(_entities.begin(), _entities.end());
+    _colliders.assign(_entities.begin(), _entities.end());
   }
-  std::unordered_set<Entity> destroyedEntities;
-
-  if (!_game || !_eventQueue)
-    return;
-  for (size_t i = 0; i < entities.size(); ++i) {
-    if (destroyedEntities.find(entities[i]) != destroyedEntities.end()) {
-      continue;
-    }
+  std::erase_if(_colliders, [this](const Entity &entity) {
+    return isPooled(entity) || isOutOfBounds(entity);
+  });
+  _removed.assign(_colliders.size(), false);
 
-    if (isOutOfBounds(entities[i]) == true) {
-      destroyedEntities.insert(entities[i]);
+  for (size_t i = 0; i < _colliders.size(); ++i) {
+    if (_removed[i])
       continue;
-    }
-
-    for (size_t j = i + 1; j < entities.size(); ++j) {
-      if (destroyedEntities.find(entities[j]) != destroyedEntities.end()) {
-        continue;
-      }
 
-      if (isOutOfBounds(entities[j]) == true) {
-        destroyedEntities.insert(entities[j]);
+    for (size_t j = i + 1; j < _colliders.size(); ++j) {
+      if (_removed[j] || !overlapAABBAABB(_colliders[i], _colliders[j]))
         continue;
-      }
 
-      if (_entities.find(entities[i]) != _entities.end() &&
-          _entities.find(entities[j]) != _entities.end() &&
-          overlapAABBAABB(entities[i], entities[j])) {
-        handleCollision(entities[i], entities[j]);
-
-        if (_entities.find(entities[i]) == _entities.end()) {
-          destroyedEntities.insert(entities[i]);
-          break;
-        }
-        if (_entities.find(entities[j]) == _entities.end()) {
-          destroyedEntities.insert(entities[j]);
-        }
+      handleCollision(_colliders[i], _colliders[j]);
+      if (isReleased(_colliders[j]))
+        _removed[j] = true;
+      if (isReleased(_colliders[i])) {
+        _removed[i] = true;
+        break;
       }
     }
   }
@@ -103,61 +88,47 @@ void ecs::CollisionSystem::handleCollision(const Entity &entity1,
   bool entity1IsPlayer = _ecsManager->hasComponent<PlayerComponent>(entity1);
   bool entity2IsPlayer = _ecsManager->hasComponent<PlayerComponent>(entity2);
 
-  std::shared_ptr<game::Enemy> enemy;
-  std::shared_ptr<game::Projectile> projectile;
-  std::shared_ptr<game::Player> player;
+  game::Enemy *enemy = nullptr;
+  game::Projectile *projectile = nullptr;
   if ((entity1IsProjectile && entity2IsEnemy) ||
       (entity2IsProjectile && entity1IsEnemy)) {
     if (entity1IsEnemy && entity2IsProjectile) {
       enemy = _game->getEnemy(
-          _ecsManager->getComponent<EnemyComponent>(entity1).enemy_id);
+          _ecsManager->getComponent<EnemyComponent>(entity1).handle);
       projectile = _game->getProjectile(
-          _ecsManager->getComponent<ProjectileComponent>(entity2)
-              .projectile_id);
+          _ecsManager->getComponent<ProjectileComponent>(entity2).handle);
     } else {
       enemy = _game->getEnemy(
-          _ecsManager->getComponent<EnemyComponent>(entity2).enemy_id);
+          _ecsManager->getComponent<EnemyComponent>(entity2).handle);
       projectile = _game->getProjectile(
-          _ecsManager->getComponent<ProjectileComponent>(entity1)
-              .projectile_id);
+          _ecsManager->getComponent<ProjectileComponent>(entity1).handle);
     }
     if (!enemy || !projectile)
       return;
     handleEnemyProjectileCollision(projectile, enemy);
   } else if ((entity1IsProjectile && entity2IsPlayer) ||
              (entity2IsProjectile && entity1IsPlayer)) {
-    if (entity1IsPlayer && entity2IsProjectile) {
-      player = _game->getPlayer(
-          _ecsManager->getComponent<PlayerComponent>(entity1).player_id);
-      projectile = _game->getProjectile(
-          _ecsManager->getComponent<ProjectileComponent>(entity2)
-              .projectile_id);
-    } else {
-      player = _game->getPlayer(
-          _ecsManager->getComponent<PlayerComponent>(entity2).player_id);
-      projectile = _game->getProjectile(
-          _ecsManager->getComponent<ProjectileComponent>(entity1)
-              .projectile_id);
-    }
+    const Entity playerEntity = entity1IsPlayer ? entity1 : entity2;
+    const Entity projectileEntity = entity1IsPlayer ? entity2 : entity1;
+    auto player = _game->getPlayer(
+        _ecsManager->getComponent<PlayerComponent>(playerEntity).handle);
+    projectile = _game->getProjectile(
+        _ecsManager->getComponent<ProjectileComponent>(projectileEntity)
+            .handle);
     if (!player || !projectile)
       return;
-    handlePlayerProjectileCollision(projectile, player);
+    handlePlayerProjectileCollision(projectile, &*player);
   } else if ((entity1IsPlayer && entity2IsEnemy) ||
              (entity2IsPlayer && entity1IsEnemy)) {
-    if (entity1IsEnemy && entity2IsPlayer) {
-      enemy = _game->getEnemy(
-          _ecsManager->getComponent<EnemyComponent>(entity1).enemy_id);
-      player = _game->getPlayer(
-          _ecsManager->getComponent<PlayerComponent>(entity2).player_id);
-    } else {
-      enemy = _game->getEnemy(
-          _ecsManager->getComponent<EnemyComponent>(entity2).enemy_id);
-      player = _game->getPlayer(
-          _ecsManager->getComponent<PlayerComponent>(entity1).player_id);
-    }
+    const Entity enemyEntity = entity1IsEnemy ? entity1 : entity2;
+    const Entity playerEntity = entity1IsEnemy ? entity2 : entity1;
+    enemy = _game->getEnemy(
+        _ecsManager->getComponent<EnemyComponent>(enemyEntity).handle);
+    auto player = _game->getPlayer(
+        _ecsManager->getComponent<PlayerComponent>(playerEntity).handle);
     if (!enemy || !player)
       return;
-    handlePlayerEnemyCollision(enemy, player);
+    handlePlayerEnemyCollision(enemy, &*player);
   }
 }
 
@@ -169,6 +140,8 @@ void ecs::CollisionSystem::handleCollision(const Entity &entity1,
  * if either entity is missing these components the function returns `false`.
  * Otherwise computes each entity's AABB using position + collider center ±
  * halfSize and reports whether the boxes intersect on both the x and y axes.
+ * Enemies tested against a lag-compensated player projectile are placed at
+ * their rewound position (see getCollisionPosition).
  *
  * @param a First entity to test for overlap (must have PositionComponent and
  * ColliderComponent).
@@ -188,8 +161,8 @@ bool ecs::CollisionSystem::overlapAABBAABB(const Entity &a,
 
   const auto &colliderA = _ecsManager->getComponent<ColliderComponent>(a);
   const auto &colliderB = _ecsManager->getComponent<ColliderComponent>(b);
-  const auto &positionA = _ecsManager->getComponent<PositionComponent>(a);
-  const auto &positionB = _ecsManager->getComponent<PositionComponent>(b);
+  const PositionComponent positionA = getCollisionPosition(a, b);
+  const PositionComponent positionB = getCollisionPosition(b, a);
 
   float axMin = positionA.x + colliderA.center.x - colliderA.halfSize.x;
   float axMax = positionA.x + colliderA.center.x + colliderA.halfSize.x;
@@ -204,6 +177,78 @@ bool ecs::CollisionSystem::overlapAABBAABB(const Entity &a,
   return (axMin <= bxMax && axMax >= bxMin && ayMin <= byMax && ayMax >= byMin);
 }
 
+/**
+ * @brief Resolve the position of an entity to use when testing it against
+ * another entity.
+ *
+ * When `target` is an enemy and `other` is a player projectile carrying a
+ * rewind delay, the enemy is rewound to where it was `rewind_ticks` ticks ago,
+ * which is what the shooter was seeing when firing. Any other pair uses the
+ * present position.
+ *
+ * @param target Entity whose position is resolved.
+ * @param other Entity `target` is being tested against.
+ * @return PositionComponent Position of `target` for this test.
+ */
+ecs::PositionComponent ecs::CollisionSystem::getCollisionPosition(
+    const Entity &target, const Entity &other) const {
+  const auto &present = _ecsManager->getComponent<PositionComponent>(target);
+
+  if (!_ecsManager->hasComponent<EnemyComponent>(target) ||
+      !_ecsManager->hasComponent<PositionHistoryComponent>(target) ||
+      !_ecsManager->hasComponent<ProjectileComponent>(other)) {
+    return present;
+  }
+  const auto &projectile =
+      _ecsManager->getComponent<ProjectileComponent>(other);
+  if (projectile.is_enemy_projectile || projectile.rewind_ticks == 0) {
+    return present;
+  }
+
+  const std::uint32_t tick = _game->getCurrentTick();
+  const std::uint32_t rewind = std::min(projectile.rewind_ticks, tick);
+  auto snapshot = _ecsManager->getComponent<PositionHistoryComponent>(target)
+                      .at(tick - rewind);
+  if (!snapshot.has_value()) {
+    return present;
+  }
+  return {snapshot->x, snapshot->y};
+}
+
+/**
+ * @brief Tell whether an entity left the game, either destroyed or returned to
+ * its pool.
+ *
+ * Pooled projectiles and enemies keep their entity and components; they are
+ * only flagged with `is_destroy` / `is_alive` and must be ignored.
+ *
+ * @param entity Entity to test.
+ * @return true if the entity must not take part in collisions.
+ */
+bool ecs::CollisionSystem::isReleased(const Entity &entity) const {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_entities.find(entity) == _entities.end())
+      return true;
+  }
+  return isPooled(entity);
+}
+
+/**
+ * @brief Tell whether a projectile or enemy entity is sitting in its pool,
+ * flagged with `is_destroy` / `is_alive`.
+ *
+ * @param entity Entity to test, known to the system.
+ * @return true if the entity is pooled.
+ */
+bool ecs::CollisionSystem::isPooled(const Entity &entity) const {
+  if (_ecsManager->hasComponent<ProjectileComponent>(entity))
+    return _ecsManager->getComponent<ProjectileComponent>(entity).is_destroy;
+  if (_ecsManager->hasComponent<EnemyComponent>(entity))
+    return !_ecsManager->getComponent<EnemyComponent>(entity).is_alive;
+  return false;
+}
+
 /**
  * @brief Handle a collision where a projectile strikes a player: apply damage,
  * emit events, and destroy affected entities.
@@ -220,13 +265,12 @@ bool ecs::CollisionSystem::overlapAABBAABB(const Entity &a,
  * projectile lacks a ProjectileComponent, the projectile is player-owned, or
  * either required health/damage is missing.
  *
- * @param projectile Shared pointer to the projectile involved; must correspond
- * to an entity with a ProjectileComponent.
- * @param player Shared pointer to the player struck by the projectile.
+ * @param projectile Projectile involved; must correspond to an entity with a
+ * ProjectileComponent.
+ * @param player Player struck by the projectile.
  */
 void ecs::CollisionSystem::handlePlayerProjectileCollision(
-    std::shared_ptr<game::Projectile> projectile,
-    std::shared_ptr<game::Player> player) {
+    game::Projectile *projectile, game::Player *player) {
   if (!projectile || !player) {
     return;
   }
@@ -270,7 +314,9 @@ void ecs::CollisionSystem::handlePlayerProjectileCollision(
     _eventQueue->addRequest(playerHitEvent);
   }
 
-  _game->destroyProjectile(projectile->getProjectileId());
+  _game->destroyProjectile(
+      _ecsManager->getComponent<ProjectileComponent>(projectile->getEntityId())
+          .handle);
 }
 
 /**
@@ -289,8 +335,8 @@ void ecs::CollisionSystem::handlePlayerProjectileCollision(
  * @param player The player involved in the collision (must provide health, id,
  * name, and position).
  */
-void ecs::CollisionSystem::handlePlayerEnemyCollision(
-    std::shared_ptr<game::Enemy> enemy, std::shared_ptr<game::Player> player) {
+void ecs::CollisionSystem::handlePlayerEnemyCollision(game::Enemy *enemy,
+                                                      game::Player *player) {
   const int collisionDamage = COLLISION_DAMAGE;
 
   if (!player->getHealth().has_value() || !enemy->getHealth().has_value()) {
@@ -309,7 +355,8 @@ void ecs::CollisionSystem::handlePlayerEnemyCollision(
     enemyDestroyEvent.sequence_number =
         _game->fetchAndIncrementSequenceNumber();
     _eventQueue->addRequest(enemyDestroyEvent);
-    _game->destroyEnemy(enemy->getEnemyId());
+    _game->destroyEnemy(
+        _ecsManager->getComponent<EnemyComponent>(enemy->getEntityId()).handle);
     incrementPlayerScore(player->getPlayerId(), enemyDestroyEvent.score);
   } else {
     queue::EnemyHitEvent enemyHitEvent;
@@ -359,8 +406,7 @@ void ecs::CollisionSystem::handlePlayerEnemyCollision(
  * @param enemy Enemy hit by the projectile; ignored if `nullptr` or if it has no health value.
  */
 void ecs::CollisionSystem::handleEnemyProjectileCollision(
-    std::shared_ptr<game::Projectile> projectile,
-    std::shared_ptr<game::Enemy> enemy) {
+    game::Projectile *projectile, game::Enemy *enemy) {
   if (!projectile || !enemy) {
     return;
   }
@@ -382,7 +428,8 @@ void ecs::CollisionSystem::handleEnemyProjectileCollision(
     enemyDestroyEvent.sequence_number =
         _game->fetchAndIncrementSequenceNumber();
     _eventQueue->addRequest(enemyDestroyEvent);
-    _game->destroyEnemy(enemy->getEnemyId());
+    _game->destroyEnemy(
+        _ecsManager->getComponent<EnemyComponent>(enemy->getEntityId()).handle);
     incrementPlayerScore(projectile->getOwnerId(), enemyDestroyEvent.score);
   } else {
     queue::EnemyHitEvent hitEvent;
@@ -394,7 +441,9 @@ void ecs::CollisionSystem::handleEnemyProjectileCollision(
     _eventQueue->addRequest(hitEvent);
   }
 
-  _game->destroyProjectile(projectile->getProjectileId());
+  _game->destroyProjectile(
+      _ecsManager->getComponent<ProjectileComponent>(projectile->getEntityId())
+          .handle);
 }
 
 /**
@@ -456,6 +505,6 @@ bool ecs::CollisionSystem::isOutOfBounds(const Entity &entity) {
   if (!isOutOfBounds)
     return false;
 
-  _game->destroyProjectile(projectile.projectile_id);
+  _game->destroyProjectile(projectile.handle);
   return true;
 }
\ No newline at end of file
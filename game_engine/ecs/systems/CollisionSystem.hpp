@@ -1,9 +1,11 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 #include "ECSManager.hpp"
 #include "Enemy.hpp"
 #include "Player.hpp"
+#include "PositionComponent.hpp"
 #include "Projectile.hpp"
 #include "Queue.hpp"
 #include "System.hpp"
@@ -65,18 +67,26 @@ namespace ecs {
 
       bool isOutOfBounds(const Entity &entity);
 
-      void handlePlayerEnemyCollision(std::shared_ptr<game::Enemy> enemy,
-                                      std::shared_ptr<game::Player> player);
-      void handlePlayerProjectileCollision(
-          std::shared_ptr<game::Projectile> projectile,
-          std::shared_ptr<game::Player> player);
-      void handleEnemyProjectileCollision(
-          std::shared_ptr<game::Projectile> projectile,
-          std::shared_ptr<game::Enemy> enemy);
+      void handlePlayerEnemyCollision(game::Enemy *enemy,
+                                      game::Player *player);
+      void handlePlayerProjectileCollision(game::Projectile *projectile,
+                                           game::Player *player);
+      void handleEnemyProjectileCollision(game::Projectile *projectile,
+                                          game::Enemy *enemy);
 
     private:
+      PositionComponent getCollisionPosition(const Entity &target,
+                                             const Entity &other) const;
+      bool isReleased(const Entity &entity) const;
+      bool isPooled(const Entity &entity) const;
+
       ECSManager *_ecsManager = nullptr;
       game::Game *_game = nullptr;
       queue::EventQueue *_eventQueue = nullptr;
+
+      /* Live colliders of the current update, and which of them a collision
+       * removed; kept to reuse their storage from tick to tick. */
+      std::vector<Entity> _colliders;
+      std::vector<bool> _removed;
   };
 }  // namespace ecs
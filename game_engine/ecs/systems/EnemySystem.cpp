@@ -1,10 +1,13 @@
 #include "EnemySystem.hpp"
+#include <algorithm>
 #include <cmath>
+#include <iterator>
 #include <limits>
 #include "EnemyComponent.hpp"
 #include "Game.hpp"
 #include "Macro.hpp"
 #include "PositionComponent.hpp"
+#include "ProjectileComponent.hpp"
 #include "ShootComponent.hpp"
 #include "VelocityComponent.hpp"
 
@@ -12,9 +15,10 @@
  * @brief Advances enemy behavior for all managed entities over the given time
  * step.
  *
- * Iterates the system's entities and, for each entity that has an
- * EnemyComponent, updates that enemy's movement and combat behavior for its
- * specific type (currently handles BASIC_FIGHTER).
+ * Caches the players' positions for the tick, then iterates the system's
+ * entities and, for each entity that has an alive EnemyComponent, updates
+ * that enemy's movement and combat behavior for its specific type (currently
+ * handles BASIC_FIGHTER).
  *
  * @param deltaTime Time elapsed since the last update, in seconds.
  */
@@ -24,12 +28,15 @@ void ecs::EnemySystem::update(float deltaTime) {
     std::lock_guard<std::mutex> lock(_mutex);
     entities = _entities;
   }
+  cachePlayerPositions();
   for (auto entity : entities) {
     if (!_ecsManager->hasComponent<EnemyComponent>(entity)) {
       continue;
     }
 
     auto &enemy = _ecsManager->getComponent<EnemyComponent>(entity);
+    if (!enemy.is_alive)
+      continue;
 
     switch (enemy.type) {
       case EnemyType::BASIC_FIGHTER:
@@ -95,12 +102,12 @@ void ecs::EnemySystem::shootAtPlayer(float deltaTime, const Entity &entity) {
       if (distance > 0) {
         if (shooting.has_active_projectile) {
           auto existingProjectile =
-              _game->getProjectile(shooting.active_projectile_id);
+              _game->getProjectile(shooting.active_projectile);
           if (existingProjectile != nullptr) {
             return;
           } else {
             shooting.has_active_projectile = false;
-            shooting.active_projectile_id = 0;
+            shooting.active_projectile = {};
           }
         }
 
@@ -114,7 +121,10 @@ void ecs::EnemySystem::shootAtPlayer(float deltaTime, const Entity &entity) {
             position.x, position.y, vx, vy);
 
         if (projectile) {
-          shooting.active_projectile_id = projectileId;
+          shooting.active_projectile =
+              _ecsManager
+                  ->getComponent<ProjectileComponent>(projectile->getEntityId())
+                  .handle;
           shooting.has_active_projectile = true;
         }
       }
@@ -123,28 +133,71 @@ void ecs::EnemySystem::shootAtPlayer(float deltaTime, const Entity &entity) {
   }
 }
 
+/**
+ * @brief Snapshot the positions of the live players for this tick, sorted by
+ * x, so enemies can target them without locking the player registry.
+ */
+void ecs::EnemySystem::cachePlayerPositions() {
+  _game->getPlayerPositions(_playerPositions);
+  std::sort(_playerPositions.begin(), _playerPositions.end());
+}
+
+/**
+ * @brief Find the player closest to the given point in the positions cached
+ * for this tick.
+ *
+ * Starts from the players whose x is closest to `enemyX` and walks outwards
+ * on both sides, stopping a side as soon as its x distance alone exceeds the
+ * best distance found so far.
+ *
+ * @param enemyX X position to search from.
+ * @param enemyY Y position to search from.
+ * @return std::pair<float, float> Position of the nearest player, or
+ * {-1, -1} if there is none.
+ */
 std::pair<float, float> ecs::EnemySystem::findNearest(float enemyX,
-                                                      float enemyY) {
-  auto players = _game->getAllPlayers();
-  if (players.empty())
+                                                      float enemyY) const {
+  if (_playerPositions.empty())
     return {-1.0f, -1.0f};
 
+  auto right = std::lower_bound(_playerPositions.begin(),
+                                _playerPositions.end(),
+                                std::pair<float, float>{enemyX, enemyY});
+  auto left = right;
   float nearestDistance = std::numeric_limits<float>::max();
-  float x;
-  float y;
+  std::pair<float, float> nearest = _playerPositions.front();
 
-  for (const auto &player : players) {
-    auto pos = player->getPosition();
+  auto consider = [&](const std::pair<float, float> &pos) {
     float dx = pos.first - enemyX;
     float dy = pos.second - enemyY;
-    float distance = std::sqrt(dx * dx + dy * dy);
-
+    float distance = dx * dx + dy * dy;
     if (distance < nearestDistance) {
       nearestDistance = distance;
-      x = pos.first;
-      y = pos.second;
+      nearest = pos;
+    }
+  };
+
+  bool searchLeft = left != _playerPositions.begin();
+  bool searchRight = right != _playerPositions.end();
+  while (searchLeft || searchRight) {
+    if (searchRight) {
+      float dx = right->first - enemyX;
+      if (dx * dx >= nearestDistance) {
+        searchRight = false;
+      } else {
+        consider(*right);
+        searchRight = ++right != _playerPositions.end();
+      }
+    }
+    if (searchLeft) {
+      float dx = enemyX - std::prev(left)->first;
+      if (dx * dx >= nearestDistance) {
+        searchLeft = false;
+      } else {
+        consider(*--left);
+        searchLeft = left != _playerPositions.begin();
+      }
     }
   }
-
-  return {x, y};
+  return nearest;
 }
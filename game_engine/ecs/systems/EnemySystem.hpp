@@ -1,5 +1,7 @@
 #pragma once
 
+#include <utility>
+#include <vector>
 #include "ECSManager.hpp"
 #include "Queue.hpp"
 #include "System.hpp"
@@ -33,8 +35,13 @@ namespace ecs {
       game::Game *_game = nullptr;
       queue::EventQueue *_eventQueue = nullptr;
 
+      /* Positions of the live players for the current tick, sorted by x.
+       * Rebuilt once per update, reusing its storage. */
+      std::vector<std::pair<float, float>> _playerPositions;
+
+      void cachePlayerPositions();
       void moveBasics(float deltaTime, const Entity &entity);
       void shootAtPlayer(float deltaTime, const Entity &entity);
-      std::pair<float, float> findNearest(float x, float y);
+      std::pair<float, float> findNearest(float x, float y) const;
   };
 }  // namespace ecs
@@ -43,7 +43,8 @@ namespace ecs {
    * - In the connected menu, pressing 'M' sends a matchmaking request.
    * - In game or room-waiting states, iterates entities with a
    * SpriteAnimationComponent to:
-   *   - send a movement input bitmask when arrow keys are pressed,
+   *   - record the held movement input bitmask, sent to the server at a fixed
+   * rate by the network loop,
    *   - update the sprite's vertical animation state (UP plays forward from the
    * neutral frame, DOWN plays backward from the neutral frame, neither or both
    * stops and resets to the neutral frame with non-negative frameTime),
@@ -66,6 +67,8 @@ namespace ecs {
       return;
     }
 
+    _client->setMovementInput(0);
+
     if (clientState != client::ClientState::IN_GAME &&
         clientState != client::ClientState::IN_ROOM_WAITING) {
       return;
@@ -96,8 +99,8 @@ namespace ecs {
       if (rightPressed)
         inputs |= static_cast<std::uint8_t>(MovementInputType::RIGHT);
 
-      if (inputs != 0 && _client != nullptr)
-        _client->sendInput(inputs);
+      if (_client != nullptr)
+        _client->setMovementInput(inputs);
 
       if (_ecsManager.hasComponent<VelocityComponent>(entity) &&
           _ecsManager.hasComponent<SpeedComponent>(entity) &&
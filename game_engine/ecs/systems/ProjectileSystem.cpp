@@ -19,6 +19,8 @@ void ecs::ProjectileSystem::update(float dt) {
     if (_ecsManagerPtr->hasComponent<ProjectileComponent>(entity)) {
       auto &projectile =
           _ecsManagerPtr->getComponent<ProjectileComponent>(entity);
+      if (projectile.is_destroy)
+        continue;
 
       switch (projectile.type) {
         case ProjectileType::PLAYER_BASIC:
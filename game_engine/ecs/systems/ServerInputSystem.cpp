@@ -1,6 +1,7 @@
 #include "ServerInputSystem.hpp"
 #include <algorithm>
 #include <cmath>
+#include <iostream>
 #include "Events.hpp"
 #include "Macro.hpp"
 #include "Packet.hpp"
@@ -8,42 +9,185 @@
 #include "PositionComponent.hpp"
 #include "SpeedComponent.hpp"
 
-void ecs::ServerInputSystem::update(float deltaTime) {
-  std::unordered_map<Entity, std::vector<PlayerInput>> inputsToProcess;
-  {
-    std::lock_guard<std::mutex> lock(_inputMutex);
-    if (_pendingInputs.empty() || !_eventQueue)
-      return;
-    inputsToProcess.swap(_pendingInputs);
-  }
+/**
+ * @brief Apply the queued inputs of every active player and emit the
+ * resulting player positions.
+ *
+ * Each input moves the player for exactly one fixed step of 1 / TPS seconds,
+ * regardless of the measured frame time. A player gets one input per tick,
+ * plus up to INPUT_CATCH_UP_STEPS saved from ticks where none was queued, so
+ * inputs recovered after a loss are caught up on quickly while a client
+ * flooding its ring still moves no faster than one step per tick on average.
+ * Rings of freed slots are discarded.
+ *
+ * @param deltaTime Elapsed time since the previous update (unused).
+ */
+void ecs::ServerInputSystem::update([[maybe_unused]] float deltaTime) {
+  if (!_eventQueue || !_ecsManagerPtr)
+    return;
 
-  for (auto &[entityId, inputs] : inputsToProcess) {
-    if (inputs.empty())
+  const std::size_t slotCount = _slotCount.load(std::memory_order_acquire);
+  for (std::size_t i = 0; i < slotCount; ++i) {
+    InputSlot &slot = _slots[i];
+    const Entity entityId = slot.entity.load(std::memory_order_acquire);
+    const std::size_t head = slot.head.load(std::memory_order_acquire);
+    slot.step_credit = std::min(slot.step_credit + 1, 1 + INPUT_CATCH_UP_STEPS);
+    if (slot.tail.load(std::memory_order_relaxed) == head)
       continue;
-    if (!_ecsManagerPtr ||
+    if (entityId == INVALID_ENTITY ||
         !_ecsManagerPtr->hasComponent<PositionComponent>(entityId) ||
-        !_ecsManagerPtr->hasComponent<SpeedComponent>(entityId))
+        !_ecsManagerPtr->hasComponent<SpeedComponent>(entityId)) {
+      slot.tail.store(head, std::memory_order_release);
       continue;
-    processInput(entityId, inputs, deltaTime);
+    }
+    processInput(entityId, slot);
     sendPositionUpdate(entityId);
   }
 }
 
-void ecs::ServerInputSystem::queueInput(Entity entityId,
+/**
+ * @brief Assign a free input slot to a newly created player entity.
+ *
+ * Must be called from the thread that queues inputs, as it resets the
+ * producer side of the slot. Inputs the previous owner left in the ring and
+ * its step credit are discarded before the slot is published, so they never
+ * apply to the new entity.
+ *
+ * @param entityId Player entity to register.
+ * @return true if a slot was assigned, false if every slot is in use.
+ */
+bool ecs::ServerInputSystem::registerPlayer(Entity entityId) {
+  if (findSlot(entityId))
+    return true;
+
+  for (std::size_t i = 0; i < MAX_INPUT_SLOTS; ++i) {
+    InputSlot &slot = _slots[i];
+    if (slot.entity.load(std::memory_order_acquire) != INVALID_ENTITY)
+      continue;
+    slot.tail.store(slot.head.load(std::memory_order_relaxed),
+                    std::memory_order_relaxed);
+    slot.step_credit = 0;
+    slot.last_queued_tick = 0;
+    slot.has_tick_lead = false;
+    slot.entity.store(entityId, std::memory_order_release);
+    if (i >= _slotCount.load(std::memory_order_relaxed))
+      _slotCount.store(i + 1, std::memory_order_release);
+    return true;
+  }
+  std::cerr << "[WARNING] No input slot left for entity " << entityId
+            << std::endl;
+  return false;
+}
+
+/**
+ * @brief Push a tick-stamped input into the ring of the given player entity.
+ *
+ * Inputs are repeated across several packets for redundancy, so any tick at
+ * or before the last tick already queued for the entity is dropped. Inputs
+ * are also dropped when the ring is full.
+ *
+ * @param entityId Player entity the input belongs to.
+ * @param input Input and the client tick it was sampled at.
+ * @return true if the input was queued, false if it was dropped.
+ */
+bool ecs::ServerInputSystem::queueInput(Entity entityId,
                                         const PlayerInput &input) {
-  std::lock_guard<std::mutex> lock(_inputMutex);
-  _pendingInputs[entityId].push_back(input);
+  InputSlot *slot = findSlot(entityId);
+  if (!slot || input.tick <= slot->last_queued_tick)
+    return false;
+
+  const std::size_t head = slot->head.load(std::memory_order_relaxed);
+  if (head - slot->tail.load(std::memory_order_acquire) >=
+      INPUT_RING_CAPACITY)
+    return false;
+
+  slot->inputs[head & (INPUT_RING_CAPACITY - 1)] = input;
+  slot->last_queued_tick = input.tick;
+  slot->head.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+/**
+ * @brief Bound the latest input tick of a PlayerInput packet by the server
+ * tick, so a client cannot queue inputs ahead of the simulation by inflating
+ * its tick numbers.
+ *
+ * Client and server ticks are not aligned, so the client's lead over the
+ * server tick is measured instead: ticks more than INPUT_JITTER_TICKS ahead of
+ * the smallest lead seen for the entity are brought back to that bound. The
+ * inputs of a clamped packet then mostly land on ticks already queued and are
+ * dropped as repeats. Must be called from the thread that queues inputs.
+ *
+ * @param entityId Player entity the inputs belong to.
+ * @param tick Client tick of the latest input of the packet.
+ * @param serverTick Current tick of the game.
+ * @return std::uint32_t The tick to queue the latest input at.
+ */
+std::uint32_t ecs::ServerInputSystem::clampInputTick(
+    Entity entityId, std::uint32_t tick, std::uint32_t serverTick) {
+  InputSlot *slot = findSlot(entityId);
+  if (!slot)
+    return tick;
+
+  const std::int64_t lead =
+      static_cast<std::int64_t>(tick) - static_cast<std::int64_t>(serverTick);
+  if (!slot->has_tick_lead || lead < slot->min_tick_lead) {
+    slot->min_tick_lead = lead;
+    slot->has_tick_lead = true;
+    return tick;
+  }
+  const std::int64_t maxLead = slot->min_tick_lead + INPUT_JITTER_TICKS;
+  if (lead <= maxLead)
+    return tick;
+  return static_cast<std::uint32_t>(static_cast<std::int64_t>(serverTick) +
+                                    maxLead);
+}
+
+/**
+ * @brief Release the input slot of an entity, so a recycled entity id starts
+ * from a clean state. Pending inputs are discarded by the next update.
+ *
+ * @param entityId Entity being destroyed.
+ */
+void ecs::ServerInputSystem::removeEntity(Entity entityId) {
+  if (InputSlot *slot = findSlot(entityId))
+    slot->entity.store(INVALID_ENTITY, std::memory_order_release);
+}
+
+/**
+ * @brief Release every input slot, e.g. when a pooled game is reset, so that
+ * lookups and updates only scan the slots of the next match.
+ */
+void ecs::ServerInputSystem::clearInputs() {
+  const std::size_t slotCount = _slotCount.load(std::memory_order_acquire);
+  for (std::size_t i = 0; i < slotCount; ++i) {
+    _slots[i].entity.store(INVALID_ENTITY, std::memory_order_release);
+  }
+  _slotCount.store(0, std::memory_order_release);
 }
 
-void ecs::ServerInputSystem::processInput(
-    Entity entityId, const std::vector<PlayerInput> &inputs, float deltaTime) {
-  float deltaX = 0.0f;
-  float deltaY = 0.0f;
+ecs::InputSlot *ecs::ServerInputSystem::findSlot(Entity entityId) {
+  const std::size_t slotCount = _slotCount.load(std::memory_order_acquire);
+  for (std::size_t i = 0; i < slotCount; ++i) {
+    if (_slots[i].entity.load(std::memory_order_acquire) == entityId)
+      return &_slots[i];
+  }
+  return nullptr;
+}
+
+void ecs::ServerInputSystem::processInput(Entity entityId, InputSlot &slot) {
   auto &position = _ecsManagerPtr->getComponent<PositionComponent>(entityId);
   const auto &speed = _ecsManagerPtr->getComponent<SpeedComponent>(entityId);
-  float moveDistance = speed.speed * deltaTime;
+  const float moveDistance = speed.speed / static_cast<float>(TPS);
 
-  for (const auto &input : inputs) {
+  std::size_t tail = slot.tail.load(std::memory_order_relaxed);
+  const std::size_t head = slot.head.load(std::memory_order_acquire);
+  for (; tail != head && slot.step_credit > 0; ++tail, --slot.step_credit) {
+    const PlayerInput &input = slot.inputs[tail & (INPUT_RING_CAPACITY - 1)];
+    if (_inputObserver)
+      _inputObserver(entityId, input);
+    float deltaX = 0.0f;
+    float deltaY = 0.0f;
     uint8_t val = static_cast<uint8_t>(input.input);
 
     if (val & static_cast<uint8_t>(MovementInputType::UP))
@@ -54,19 +198,20 @@ void ecs::ServerInputSystem::processInput(
       deltaX -= 1.0f;
     if (val & static_cast<uint8_t>(MovementInputType::RIGHT))
       deltaX += 1.0f;
-  }
 
-  float length = std::sqrt(deltaX * deltaX + deltaY * deltaY);
-  if (length > 0.0f) {
-    deltaX = (deltaX / length) * moveDistance;
-    deltaY = (deltaY / length) * moveDistance;
-  }
+    float length = std::sqrt(deltaX * deltaX + deltaY * deltaY);
+    if (length > 0.0f) {
+      deltaX = (deltaX / length) * moveDistance;
+      deltaY = (deltaY / length) * moveDistance;
+    }
 
-  position.x += deltaX;
-  position.y += deltaY;
+    position.x += deltaX;
+    position.y += deltaY;
 
-  position.x = std::clamp(position.x, 0.0f, static_cast<float>(WINDOW_WIDTH) - PLAYER_WIDTH);
-  position.y = std::clamp(position.y, 0.0f, static_cast<float>(WINDOW_HEIGHT) - PLAYER_HEIGHT);
+    position.x = std::clamp(position.x, 0.0f, static_cast<float>(WINDOW_WIDTH) - PLAYER_WIDTH);
+    position.y = std::clamp(position.y, 0.0f, static_cast<float>(WINDOW_HEIGHT) - PLAYER_HEIGHT);
+  }
+  slot.tail.store(tail, std::memory_order_release);
 }
 
 void ecs::ServerInputSystem::sendPositionUpdate(Entity entityId) {
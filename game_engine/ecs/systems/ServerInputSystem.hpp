@@ -1,19 +1,52 @@
 #pragma once
 
-#include <chrono>
-#include <mutex>
-#include <unordered_map>
-#include <vector>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
 #include "ECSManager.hpp"
+#include "Macro.hpp"
 #include "Packet.hpp"
 #include "Queue.hpp"
 #include "System.hpp"
-#include <mutex>
 
 namespace ecs {
+  constexpr std::size_t INPUT_RING_CAPACITY = 64;  // must be a power of two
+  constexpr std::size_t MAX_INPUT_SLOTS =
+      std::numeric_limits<std::uint8_t>::max();
+
+  static_assert((INPUT_RING_CAPACITY & (INPUT_RING_CAPACITY - 1)) == 0,
+                "INPUT_RING_CAPACITY must be a power of two");
+
   struct PlayerInput {
       MovementInputType input;
-      int sequence_number;
+      std::uint32_t tick;
+  };
+
+  /**
+   * @brief Fixed-capacity single-producer/single-consumer ring of inputs
+   * owned by one player.
+   *
+   * The network thread is the only producer (it also registers players) and
+   * the simulation thread is the only consumer, so pushing and draining only
+   * need acquire/release ordering on the two indices and never allocate.
+   * Indices grow monotonically and are masked on access.
+   *
+   * `min_tick_lead` (producer side) is the smallest lead of the client's
+   * input ticks over the server tick seen so far, and `step_credit`
+   * (consumer side) the inputs that may still be applied this tick.
+   */
+  struct InputSlot {
+      std::atomic<Entity> entity{INVALID_ENTITY};
+      std::uint32_t last_queued_tick = 0;
+      std::int64_t min_tick_lead = 0;
+      bool has_tick_lead = false;
+      std::size_t step_credit = 0;
+      alignas(64) std::atomic<std::size_t> head{0};
+      alignas(64) std::atomic<std::size_t> tail{0};
+      std::array<PlayerInput, INPUT_RING_CAPACITY> inputs{};
   };
 
   class ServerInputSystem : public System {
@@ -26,20 +59,35 @@ namespace ecs {
       void setEventQueue(queue::EventQueue *eventQueue) {
         _eventQueue = eventQueue;
       }
+      /**
+       * @brief Set a callback invoked for every input applied to a player,
+       * in application order. Used to record matches for replay.
+       *
+       * @param observer Callback, or an empty function to disable it.
+       */
+      void setInputObserver(
+          std::function<void(Entity, const PlayerInput &)> observer) {
+        _inputObserver = std::move(observer);
+      }
+
       void update(float deltaTime) override;
 
-      void queueInput(Entity entityId, const PlayerInput &input);
-      void processInput(Entity entityId, const std::vector<PlayerInput> &input,
-                        float deltaTime);
+      bool registerPlayer(Entity entityId);
+      bool queueInput(Entity entityId, const PlayerInput &input);
+      std::uint32_t clampInputTick(Entity entityId, std::uint32_t tick,
+                                   std::uint32_t serverTick);
+      void processInput(Entity entityId, InputSlot &slot);
       void sendPositionUpdate(Entity entityId);
+      void removeEntity(Entity entityId);
+      void clearInputs();
 
     private:
+      InputSlot *findSlot(Entity entityId);
+
       ECSManager *_ecsManagerPtr = nullptr;
       queue::EventQueue *_eventQueue = nullptr;
-      std::unordered_map<Entity, std::vector<PlayerInput>> _pendingInputs;
-      mutable std::mutex _inputMutex;
-      std::unordered_map<Entity, std::chrono::steady_clock::time_point>
-          _lastInputTime;
-      std::mutex _pendingInputsMutex;
+      std::array<InputSlot, MAX_INPUT_SLOTS> _slots;
+      std::atomic<std::size_t> _slotCount{0};
+      std::function<void(Entity, const PlayerInput &)> _inputObserver;
   };
 }  // namespace ecs
@@ -0,0 +1,209 @@
+#include <asio.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Macro.hpp"
+#include "ServerNetworkManager.hpp"
+
+namespace {
+  constexpr std::size_t BENCH_WINDOW = 64;  // datagrams in flight
+  constexpr std::uint32_t BENCH_FLOWS = 8;  // client sockets (4-tuples)
+  constexpr auto BENCH_STALL_TIMEOUT = std::chrono::milliseconds(500);
+
+  struct BenchResult {
+      std::size_t sent = 0;
+      std::size_t echoed = 0;
+      double seconds = 0.0;
+  };
+
+  /**
+   * @brief One client socket; each has its own 4-tuple, so SO_REUSEPORT
+   * spreads the flows across the server sockets.
+   */
+  struct BenchFlow {
+      BenchFlow(asio::io_context &io_context, std::uint32_t flow_id,
+                std::size_t size)
+          : socket(io_context,
+                   asio::ip::udp::endpoint(asio::ip::udp::v4(), 0)),
+            payload(size, 'x'),
+            reply(BUFFER_SIZE) {
+        std::memcpy(payload.data(), &flow_id, sizeof(flow_id));
+      }
+
+      asio::ip::udp::socket socket;
+      std::vector<char> payload;
+      std::vector<char> reply;
+      asio::ip::udp::endpoint sender;
+      std::size_t in_flight = 0;
+  };
+
+  /**
+   * @brief Stream `packets` datagrams of `size` bytes to the echo server over
+   * BENCH_FLOWS client sockets and count the echoes.
+   *
+   * At most BENCH_WINDOW datagrams are in flight: every echo lets one more
+   * datagram go on the same socket, so the server is kept busy without
+   * overflowing the socket buffers. When no echo arrives for
+   * BENCH_STALL_TIMEOUT the datagrams still in flight are counted as lost and
+   * the window is refilled.
+   */
+  BenchResult runClient(std::uint16_t port, std::size_t packets,
+                        std::size_t size) {
+    asio::io_context io_context;
+    asio::ip::udp::endpoint server(asio::ip::address_v4::loopback(), port);
+    asio::steady_timer watchdog(io_context);
+    std::vector<std::unique_ptr<BenchFlow>> flows;
+    for (std::uint32_t i = 0; i < BENCH_FLOWS; ++i)
+      flows.push_back(std::make_unique<BenchFlow>(io_context, i, size));
+
+    BenchResult result;
+    std::size_t lost = 0;
+    std::size_t lastEchoed = 0;
+    const std::size_t flowWindow =
+        std::max<std::size_t>(1, BENCH_WINDOW / BENCH_FLOWS);
+
+    auto fillWindow = [&](BenchFlow &flow) {
+      while (result.sent < packets && flow.in_flight < flowWindow) {
+        ++result.sent;
+        ++flow.in_flight;
+        flow.socket.async_send_to(asio::buffer(flow.payload), server,
+                                  [](const asio::error_code &, std::size_t) {
+                                  });
+      }
+    };
+    std::function<void(BenchFlow &)> receive = [&](BenchFlow &flow) {
+      flow.socket.async_receive_from(
+          asio::buffer(flow.reply), flow.sender,
+          [&](const asio::error_code &error, std::size_t) {
+            if (error)
+              return;
+            ++result.echoed;
+            if (flow.in_flight > 0)
+              --flow.in_flight;
+            if (result.echoed + lost >= packets) {
+              io_context.stop();
+              return;
+            }
+            fillWindow(flow);
+            receive(flow);
+          });
+    };
+    std::function<void()> watch = [&]() {
+      watchdog.expires_after(BENCH_STALL_TIMEOUT);
+      watchdog.async_wait([&](const asio::error_code &error) {
+        if (error)
+          return;
+        if (result.echoed == lastEchoed) {
+          lost = result.sent - result.echoed;
+          if (result.echoed + lost >= packets) {
+            io_context.stop();
+            return;
+          }
+          for (auto &flow : flows) {
+            flow->in_flight = 0;
+            fillWindow(*flow);
+          }
+        }
+        lastEchoed = result.echoed;
+        watch();
+      });
+    };
+
+    const auto start = std::chrono::steady_clock::now();
+    for (auto &flow : flows) {
+      receive(*flow);
+      fillWindow(*flow);
+    }
+    watch();
+    io_context.run();
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    result.seconds = elapsed.count();
+    return result;
+  }
+
+  /**
+   * @brief Run an echo server on `port` with the requested I/O mode and
+   * number of sockets, drive it with runClient() and print the achieved
+   * packet rate.
+   *
+   * The first bytes of each datagram carry the client flow id, used as the
+   * client id the echo is sent back to.
+   */
+  void runMode(bool batched, std::uint16_t port, std::size_t packets,
+               std::size_t size, std::size_t sockets) {
+    network::ServerNetworkManager server(port, batched, sockets);
+    server.startReceive([&server](const char *data, std::size_t length) {
+      std::uint32_t flow = 0;
+      std::memcpy(&flow, data, sizeof(flow));
+      server.registerClient(static_cast<int>(flow),
+                            server.getRemoteEndpoint());
+      server.sendToClient(static_cast<int>(flow), data, length);
+    });
+    std::thread serverThread([&server]() { server.run(); });
+
+    BenchResult result = runClient(port, packets, size);
+
+    asio::post(server.getIoContext(), [&server]() { server.stop(); });
+    serverThread.join();
+
+    const double pps = result.seconds > 0.0 ? result.echoed / result.seconds
+                                            : 0.0;
+    std::cout << (server.isBatchedIo() ? "batched" : "single ") << " x"
+              << server.getSocketCount() << ": "
+              << result.echoed << "/" << result.sent << " echoed in "
+              << result.seconds << " s, " << static_cast<std::uint64_t>(pps)
+              << " round trips/s ("
+              << static_cast<std::uint64_t>(2 * pps)
+              << " server datagrams/s)" << std::endl;
+  }
+}  // namespace
+
+/**
+ * @brief Measure how many datagrams per second the server network layer
+ * handles on loopback, with recvmmsg/sendmmsg batching and with one asio
+ * operation per datagram, over one or several SO_REUSEPORT sockets.
+ *
+ * Each mode starts an echo server on the given port and streams datagrams to
+ * it from BENCH_FLOWS client sockets with a fixed in-flight window; every
+ * round trip is one datagram received and one sent by the server.
+ */
+int main(int ac, char **av) {
+  if (ac > 6 || (ac > 1 && std::strcmp(av[1], "--help") == 0)) {
+    std::cout << "Usage: ./r_type_net_bench [packets] [size] [port] "
+                 "[batched|single|both] [sockets]"
+              << std::endl;
+    return ac > 1 && std::strcmp(av[1], "--help") == 0 ? OK : KO;
+  }
+
+  const std::size_t packets = ac > 1 ? std::strtoul(av[1], nullptr, 10)
+                                     : 1000000;
+  const std::size_t size = ac > 2 ? std::strtoul(av[2], nullptr, 10) : 64;
+  const auto port = static_cast<std::uint16_t>(
+      ac > 3 ? std::strtoul(av[3], nullptr, 10) : 4243);
+  const std::string mode = ac > 4 ? av[4] : "both";
+  const std::size_t sockets = ac > 5 ? std::strtoul(av[5], nullptr, 10) : 1;
+
+  if (packets == 0 || size < sizeof(std::uint32_t) || size > BUFFER_SIZE ||
+      sockets == 0 ||
+      (mode != "batched" && mode != "single" && mode != "both")) {
+    std::cerr << "[ERROR] Invalid arguments, see --help" << std::endl;
+    return KO;
+  }
+
+  std::cout << packets << " datagrams of " << size << " bytes, window "
+            << BENCH_WINDOW << std::endl;
+  if (mode != "single")
+    runMode(true, port, packets, size, sockets);
+  if (mode != "batched")
+    runMode(false, port, packets, size, sockets);
+  return OK;
+}
@@ -0,0 +1,309 @@
+#include <lz4.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <variant>
+#include <vector>
+#include "Events.hpp"
+#include "Game.hpp"
+#include "CompactCodec.hpp"
+#include "Macro.hpp"
+#include "PacketBuilder.hpp"
+#include "PacketCompressor.hpp"
+#include "PacketUtils.hpp"
+#include "Replay.hpp"
+#include "Serializer.hpp"
+
+namespace {
+  // LZ4 only looks 64 KiB back, but packets are tens of bytes: a few KiB of
+  // samples cover every layout and keep training output reviewable
+  constexpr std::size_t DICTIONARY_CAPACITY = 4096;
+  constexpr std::size_t LEGACY_LZ4_HEADER_SIZE = 12;
+
+  using Packets = std::vector<serialization::Buffer>;
+
+  /**
+   * @brief Serialize the packet the server broadcasts for a game event, as
+   * Server::handleGameEvent builds it.
+   */
+  serialization::Buffer toPacket(const queue::GameEvent &event) {
+    return std::visit(
+        [](const auto &e) -> serialization::Buffer {
+          using T = std::decay_t<decltype(e)>;
+          using serialization::BitserySerializer;
+
+          if constexpr (std::is_same_v<T, queue::EnemySpawnEvent>) {
+            return BitserySerializer::serialize(PacketBuilder::makeEnemySpawn(
+                e.enemy_id, EnemyType::BASIC_FIGHTER, e.x, e.y, e.vx, e.vy,
+                e.health, e.max_health, e.sequence_number));
+          } else if constexpr (std::is_same_v<T, queue::EnemyDestroyEvent>) {
+            return BitserySerializer::serialize(PacketBuilder::makeEnemyDeath(
+                e.enemy_id, e.x, e.y, e.player_id, e.score,
+                e.sequence_number));
+          } else if constexpr (std::is_same_v<T, queue::EnemyHitEvent>) {
+            return BitserySerializer::serialize(PacketBuilder::makeEnemyHit(
+                e.enemy_id, e.x, e.y, e.damage, e.sequence_number));
+          } else if constexpr (std::is_same_v<T, queue::EnemyMoveEvent>) {
+            return BitserySerializer::serialize(PacketBuilder::makeEnemyMove(
+                e.enemy_id, e.x, e.y, e.vx, e.vy, e.sequence_number));
+          } else if constexpr (std::is_same_v<T,
+                                              queue::ProjectileSpawnEvent>) {
+            return BitserySerializer::serialize(
+                PacketBuilder::makeProjectileSpawn(
+                    e.projectile_id, e.type, e.x, e.y, e.vx, e.vy,
+                    e.is_enemy_projectile, e.damage, e.owner_id,
+                    e.sequence_number));
+          } else if constexpr (std::is_same_v<T, queue::PlayerHitEvent>) {
+            return BitserySerializer::serialize(PacketBuilder::makePlayerHit(
+                e.player_id, e.damage, e.x, e.y, e.sequence_number));
+          } else if constexpr (std::is_same_v<T,
+                                              queue::ProjectileDestroyEvent>) {
+            return BitserySerializer::serialize(
+                PacketBuilder::makeProjectileDestroy(e.projectile_id, e.x, e.y,
+                                                     e.sequence_number));
+          } else if constexpr (std::is_same_v<T, queue::PlayerDestroyEvent>) {
+            return BitserySerializer::serialize(PacketBuilder::makePlayerDeath(
+                e.player_id, e.x, e.y, e.sequence_number));
+          } else if constexpr (std::is_same_v<T, queue::PlayerDiedEvent>) {
+            return BitserySerializer::serialize(PacketBuilder::makeChatMessage(
+                e.player_name + " has died.", SERVER_SENDER_ID, 255, 0, 0, 255,
+                e.sequence_number));
+          } else if constexpr (std::is_same_v<T, queue::PositionEvent>) {
+            return BitserySerializer::serialize(PacketBuilder::makePlayerMove(
+                e.player_id, e.sequence_number, e.x, e.y));
+          } else if constexpr (std::is_same_v<T, queue::GameStartEvent>) {
+            return BitserySerializer::serialize(
+                PacketBuilder::makeGameStart(e.game_started,
+                                             e.sequence_number));
+          } else {
+            return BitserySerializer::serialize(
+                PacketBuilder::makeGameEnd(e.game_ended, e.sequence_number));
+          }
+        },
+        event);
+  }
+
+  /**
+   * @brief Replay a recording and collect every packet its game events
+   * produce, in order.
+   */
+  bool collectPackets(const char *path, Packets &packets) {
+    game::RoomRecordReader reader;
+    if (!reader.open(path)) {
+      std::cerr << "[ERROR] " << path << " is not a valid room recording"
+                << std::endl;
+      return false;
+    }
+    game::Game game(reader.getSeed());
+    queue::GameEvent event;
+    replay::run(reader, game, [&](float deltaTime) {
+      game.tick(deltaTime);
+      while (game.getEventQueue().popRequest(event)) {
+        auto packet = toPacket(event);
+        if (!packet.empty())
+          packets.push_back(std::move(packet));
+      }
+    });
+    return true;
+  }
+
+  std::size_t legacySize(const serialization::Buffer &packet) {
+    std::vector<char> out(LZ4_compressBound(static_cast<int>(packet.size())));
+    const int size = LZ4_compress_default(
+        reinterpret_cast<const char *>(packet.data()), out.data(),
+        static_cast<int>(packet.size()), static_cast<int>(out.size()));
+    return LEGACY_LZ4_HEADER_SIZE + static_cast<std::size_t>(size);
+  }
+
+  /**
+   * @brief Print, per packet type, the bytes a recorded session takes
+   * uncompressed, with plain LZ4 behind the former 12-byte header, with the
+   * dictionary behind the compact header, on the wire under the current
+   * compression policy, and on the wire to clients that negotiate the
+   * compact encoding, which get it when it is smaller.
+   */
+  int report(const char *path) {
+    Packets packets;
+    if (!collectPackets(path, packets))
+      return KO;
+
+    struct Totals {
+        std::size_t count = 0;
+        std::size_t raw = 0;
+        std::size_t legacy = 0;
+        std::size_t dictionary = 0;
+        std::size_t wire = 0;
+        std::size_t compact = 0;
+    };
+    std::map<std::uint8_t, Totals> byType;
+    Totals all;
+    serialization::Buffer compacted;
+    for (const auto &packet : packets) {
+      Totals &totals = byType[packet[0]];
+      const std::size_t legacy = legacySize(packet);
+      const std::size_t dictionary =
+          compression::Compressor::compress(packet, 1e9f).size();
+      const std::size_t wire =
+          compression::Compressor::shouldCompress(packet)
+              ? compression::Compressor::compress(packet).size()
+              : packet.size();
+      std::size_t compact =
+          serialization::CompactCodec::encode(packet, compacted);
+      if (compact == 0 || compact > wire)
+        compact = wire;
+      for (Totals *t : {&totals, &all}) {
+        t->count++;
+        t->raw += packet.size();
+        t->legacy += legacy;
+        t->dictionary += dictionary;
+        t->wire += wire;
+        t->compact += compact;
+      }
+    }
+
+    const auto ratio = [](std::size_t bytes, std::size_t raw) {
+      return raw == 0 ? 0.0 : static_cast<double>(bytes) / raw;
+    };
+    std::cout << std::left << std::setw(20) << "Type" << std::right
+              << std::setw(8) << "Count" << std::setw(10) << "Raw"
+              << std::setw(10) << "LZ4" << std::setw(10) << "Dict"
+              << std::setw(10) << "Wire" << std::setw(8) << "Ratio"
+              << std::setw(10) << "Compact" << std::setw(8) << "Ratio"
+              << "  Policy" << std::endl;
+    std::cout << std::fixed << std::setprecision(3);
+    for (const auto &[type, totals] : byType) {
+      const auto packetType = static_cast<PacketType>(type);
+      std::cout << std::left << std::setw(20)
+                << packetTypeToString(packetType) << std::right
+                << std::setw(8) << totals.count << std::setw(10)
+                << totals.raw << std::setw(10) << totals.legacy
+                << std::setw(10) << totals.dictionary << std::setw(10)
+                << totals.wire << std::setw(8)
+                << ratio(totals.wire, totals.raw) << std::setw(10)
+                << totals.compact << std::setw(8)
+                << ratio(totals.compact, totals.raw) << "  "
+                << (shouldCompressPacketType(packetType) ? "compress"
+                                                         : "plain")
+                << std::endl;
+    }
+    std::cout << std::left << std::setw(20) << "Total" << std::right
+              << std::setw(8) << all.count << std::setw(10) << all.raw
+              << std::setw(10) << all.legacy << std::setw(10)
+              << all.dictionary << std::setw(10) << all.wire << std::setw(8)
+              << ratio(all.wire, all.raw) << std::setw(10) << all.compact
+              << std::setw(8) << ratio(all.compact, all.raw) << std::endl;
+    std::cout << "Dictionary: " << compression::DICTIONARY.size() << " bytes"
+              << std::endl;
+    return OK;
+  }
+
+  /**
+   * @brief Build a dictionary from the packets of recorded sessions.
+   *
+   * Each packet type gets a share of DICTIONARY_CAPACITY proportional to the
+   * bytes it accounts for, at least one packet, filled with distinct packets
+   * taken evenly over the sessions. LZ4 keeps the latest position of each
+   * hashed sequence, so the heaviest types are written last, where their
+   * matches win.
+   */
+  serialization::Buffer train(const Packets &packets) {
+    std::map<std::uint8_t, Packets> byType;
+    std::map<std::uint8_t, std::size_t> bytes;
+    std::size_t total = 0;
+    for (const auto &packet : packets) {
+      auto &samples = byType[packet[0]];
+      if (std::find(samples.begin(), samples.end(), packet) == samples.end())
+        samples.push_back(packet);
+      bytes[packet[0]] += packet.size();
+      total += packet.size();
+    }
+
+    std::vector<std::uint8_t> order;
+    for (const auto &[type, samples] : byType)
+      order.push_back(type);
+    std::sort(order.begin(), order.end(), [&](std::uint8_t a, std::uint8_t b) {
+      return bytes[a] < bytes[b];
+    });
+
+    serialization::Buffer dictionary;
+    for (std::uint8_t type : order) {
+      const Packets &samples = byType[type];
+      const std::size_t share = DICTIONARY_CAPACITY * bytes[type] / total;
+      const std::size_t wanted = std::clamp<std::size_t>(
+          share / samples.front().size(), 1, samples.size());
+      for (std::size_t i = 0; i < wanted; ++i) {
+        const auto &sample = samples[i * samples.size() / wanted];
+        if (dictionary.size() + sample.size() > DICTIONARY_CAPACITY)
+          break;
+        dictionary.insert(dictionary.end(), sample.begin(), sample.end());
+      }
+    }
+    return dictionary;
+  }
+
+  bool writeDictionary(const char *path,
+                       const serialization::Buffer &dictionary) {
+    std::ofstream out(path);
+    if (!out)
+      return false;
+    out << "#pragma once\n\n#include <array>\n#include <cstdint>\n\n"
+        << "// Generated by r_type_lz4_dict train; do not edit.\n\n"
+        << "namespace compression {\n\n"
+        << "  /**\n"
+        << "   * @brief Packets sampled from recorded matches, which prime "
+           "LZ4 so that\n"
+        << "   * small packets find matches. Client and server must use the "
+           "same one.\n"
+        << "   */\n"
+        << "  inline constexpr std::array<std::uint8_t, " << dictionary.size()
+        << "> DICTIONARY = {";
+    for (std::size_t i = 0; i < dictionary.size(); ++i) {
+      out << (i % 12 == 0 ? "\n      " : " ") << "0x" << std::hex
+          << std::setw(2) << std::setfill('0')
+          << static_cast<int>(dictionary[i]) << std::dec
+          << (i + 1 < dictionary.size() ? "," : "");
+    }
+    out << "};\n\n}  // namespace compression\n";
+    return static_cast<bool>(out);
+  }
+}  // namespace
+
+/**
+ * @brief Train the LZ4 dictionary shipped with client and server from room
+ * recordings, or report the compression a recording achieves with it.
+ *
+ * Recordings are replayed headless and the packets their game events produce
+ * are serialized as the server would send them.
+ */
+int main(int ac, char **av) {
+  if (ac == 3 && std::strcmp(av[1], "report") == 0)
+    return report(av[2]);
+  if (ac >= 4 && std::strcmp(av[1], "train") == 0) {
+    Packets packets;
+    for (int i = 3; i < ac; ++i)
+      if (!collectPackets(av[i], packets))
+        return KO;
+    if (packets.empty()) {
+      std::cerr << "[ERROR] No packets in the recordings" << std::endl;
+      return KO;
+    }
+    const auto dictionary = train(packets);
+    if (!writeDictionary(av[2], dictionary)) {
+      std::cerr << "[ERROR] Cannot write " << av[2] << std::endl;
+      return KO;
+    }
+    std::cout << "Trained a " << dictionary.size() << "-byte dictionary on "
+              << packets.size() << " packets" << std::endl;
+    return OK;
+  }
+  std::cout << "Usage: ./r_type_lz4_dict report <recording.rrec>\n"
+            << "       ./r_type_lz4_dict train <dictionary.hpp> "
+               "<recording.rrec>..."
+            << std::endl;
+  return ac == 2 && std::strcmp(av[1], "--help") == 0 ? OK : KO;
+}
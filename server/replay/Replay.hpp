@@ -0,0 +1,68 @@
+#pragma once
+
+#include "Game.hpp"
+#include "Macro.hpp"
+#include "Packet.hpp"
+#include "RoomRecorder.hpp"
+
+namespace replay {
+
+  /**
+   * @brief Apply a non-tick record to the game being replayed, mirroring
+   * what the network handlers did when the match was recorded.
+   *
+   * @param game Game being replayed.
+   * @param record Join, Leave, Input or Shoot record.
+   */
+  inline void applyRecord(game::Game &game,
+                          const game::RoomRecordReader::Record &record) {
+    switch (record.type) {
+      case game::RecordType::Join:
+        game.createPlayer(record.player_id, record.name);
+        break;
+      case game::RecordType::Leave:
+        game.destroyPlayer(record.player_id);
+        break;
+      case game::RecordType::Input: {
+        auto player = game.getPlayerState(record.player_id);
+        if (player)
+          game.getServerInputSystem()->queueInput(
+              player->entity_id,
+              {static_cast<MovementInputType>(record.input),
+               record.client_tick});
+        break;
+      }
+      case game::RecordType::Shoot: {
+        auto player = game.getPlayerState(record.player_id);
+        if (!player)
+          break;
+        auto pos = player->position;
+        game.createProjectile(game.getNextProjectileId(), record.player_id,
+                              ProjectileType::PLAYER_BASIC, pos.first,
+                              pos.second, PROJECTILE_SPEED, 0.0f,
+                              record.rewind_ticks);
+        break;
+      }
+      case game::RecordType::Tick:
+        break;
+    }
+  }
+
+  /**
+   * @brief Replay a whole recording into `game`, built with the recorded
+   * seed: every record is applied before the tick it was recorded in, and
+   * `onTick(deltaTime)` runs each tick.
+   */
+  template <typename Func>
+  void run(game::RoomRecordReader &reader, game::Game &game, Func &&onTick) {
+    game::RoomRecordReader::Record record;
+    while (reader.next(record)) {
+      if (record.type != game::RecordType::Tick) {
+        applyRecord(game, record);
+        continue;
+      }
+      onTick(record.delta_time);
+    }
+  }
+
+}  // namespace replay
@@ -0,0 +1,76 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <vector>
+#include "Events.hpp"
+#include "Game.hpp"
+#include "Macro.hpp"
+#include "Replay.hpp"
+
+namespace {
+  double percentile(const std::vector<double> &sorted, double ratio) {
+    if (sorted.empty())
+      return 0.0;
+    std::size_t index = static_cast<std::size_t>(ratio * (sorted.size() - 1));
+    return sorted[index];
+  }
+}  // namespace
+
+/**
+ * @brief Replay a room recording headless, as fast as possible, and report
+ * tick timings.
+ *
+ * The game is rebuilt with the recorded seed, then every recorded join,
+ * leave, shot and input is applied before the tick it was recorded in.
+ * Ticks run back to back with their recorded delta time and the produced
+ * game events are discarded.
+ */
+int main(int ac, char **av) {
+  if (ac != 2 || std::strcmp(av[1], "--help") == 0) {
+    std::cout << "Usage: ./r_type_replay <recording.rrec>" << std::endl;
+    return ac == 2 ? OK : KO;
+  }
+
+  game::RoomRecordReader reader;
+  if (!reader.open(av[1])) {
+    std::cerr << "[ERROR] " << av[1] << " is not a valid room recording"
+              << std::endl;
+    return KO;
+  }
+
+  game::Game game(reader.getSeed());
+  queue::GameEvent event;
+  std::vector<double> tickTimes;
+
+  const auto replayStart = std::chrono::steady_clock::now();
+  replay::run(reader, game, [&](float deltaTime) {
+    const auto tickStart = std::chrono::steady_clock::now();
+    game.tick(deltaTime);
+    const std::chrono::duration<double, std::micro> tickTime =
+        std::chrono::steady_clock::now() - tickStart;
+    tickTimes.push_back(tickTime.count());
+    while (game.getEventQueue().popRequest(event)) {
+    }
+  });
+  const std::chrono::duration<double> replayTime =
+      std::chrono::steady_clock::now() - replayStart;
+
+  std::sort(tickTimes.begin(), tickTimes.end());
+  double total = 0.0;
+  for (double time : tickTimes)
+    total += time;
+
+  std::cout << "Seed: " << reader.getSeed() << std::endl;
+  std::cout << "Ticks: " << tickTimes.size() << " in " << replayTime.count()
+            << " s (" << tickTimes.size() / replayTime.count() << " ticks/s)"
+            << std::endl;
+  if (!tickTimes.empty()) {
+    std::cout << "Tick time (us): mean " << total / tickTimes.size()
+              << ", p50 " << percentile(tickTimes, 0.50) << ", p99 "
+              << percentile(tickTimes, 0.99) << ", max " << tickTimes.back()
+              << std::endl;
+  }
+  return OK;
+}
@@ -13,8 +13,34 @@
 
 namespace broadcast {
 
+  /**
+   * @brief Datagram produced by a broadcast: serialized and compressed once,
+   * shared by every recipient and meant to be stored as is in their
+   * retransmit queues. Never modified once built.
+   */
+  using WireBuffer = std::shared_ptr<std::vector<std::uint8_t>>;
+
   struct Broadcast {
     public:
+      /**
+       * @brief Serialize a packet into a pooled send buffer and compress it,
+       * ready to be sent to any number of clients.
+       *
+       * @return WireBuffer The datagram; null if serialization failed.
+       */
+      template <typename Packet>
+      static WireBuffer prepare(network::ServerNetworkManager &networkManager,
+                                const Packet &packet) {
+        auto buffer = networkManager.acquireSendBuffer();
+        serialization::BitserySerializer::serializeInto(*buffer, packet);
+        if (buffer->empty()) {
+          std::cerr << "[ERROR] Failed to serialize packet for broadcast."
+                    << std::endl;
+          return nullptr;
+        }
+        return network::ServerNetworkManager::prepareForWire(buffer);
+      }
+
       template <typename Packet, typename Pred>
       /**
        * @brief Serializes a packet and sends it to each client in the list that
@@ -27,44 +53,45 @@ namespace broadcast {
        * @param packet Packet to serialize and send.
        * @param pred Predicate invoked with a `server::Client` reference; the
        * packet is sent to a client only if `pred` returns true.
+       * @return WireBuffer The datagram sent to every recipient, to be reused
+       * for their retransmit queues; null if serialization failed.
+       *
+       * The packet is serialized once into a pooled send buffer and compressed
+       * once, then sent along each client's cached route, without any
+       * per-recipient lookup or copy.
        */
-      static void broadcastTo(
+      static WireBuffer broadcastTo(
           network::ServerNetworkManager &networkManager,
           const std::vector<std::shared_ptr<server::Client>> &clients,
           const Packet &packet, Pred pred) {
-        serialization::Buffer serializedBuffer =
-            serialization::BitserySerializer::serialize(packet);
-        if (serializedBuffer.empty()) {
-          std::cerr << "[ERROR] Failed to serialize packet for broadcast."
-                    << std::endl;
-          return;
-        }
-        auto buffer =
-            std::make_shared<std::vector<std::uint8_t>>(serializedBuffer);
+        auto buffer = prepare(networkManager, packet);
+        if (!buffer)
+          return nullptr;
 
         for (const auto &client : clients) {
           if (client && client->_connected &&
               client->_player_id != INVALID_ID && pred(*client)) {
-            networkManager.sendToClient(client->_player_id, buffer);
+            networkManager.sendPrepared(client->_route, buffer);
           }
         }
+        return buffer;
       }
 
       template <typename Packet>
-      static void broadcastToAll(
+      static WireBuffer broadcastToAll(
           network::ServerNetworkManager &networkManager,
           const std::vector<std::shared_ptr<server::Client>> &clients,
           const Packet &packet) {
-        broadcastTo(networkManager, clients, packet,
-                    [](const auto &) { return true; });
+        return broadcastTo(networkManager, clients, packet,
+                           [](const auto &) { return true; });
       }
 
       template <typename Packet>
-      static void broadcastToRoom(
+      static WireBuffer broadcastToRoom(
           network::ServerNetworkManager &networkManager,
           const std::vector<std::shared_ptr<server::Client>> &roomClients,
           const Packet &packet) {
-        broadcastToAll(networkManager, roomClients, packet);
+        return broadcastToAll(networkManager, roomClients, packet);
       }
 
       /**
@@ -87,35 +114,29 @@ namespace broadcast {
           network::ServerNetworkManager &networkManager, game::Game &game,
           server::Client &client,
           const std::vector<std::shared_ptr<server::Client>> &roomClients) {
-        auto players = game.getAllPlayers();
+        std::vector<game::PlayerState> players;
+        game.getPlayerStates(players);
 
         for (const auto &player : players) {
-          if (player && player->isConnected() &&
-              player->getPlayerId() != client._player_id) {
-            std::pair<float, float> pos = player->getPosition();
-            float speed = player->getSpeed();
-            int maxHealth = player->getMaxHealth().value_or(100);
-            std::string playerName = player->getName();
-
+          if (player.connected && player.player_id != client._player_id) {
             std::uint32_t seq = game.getSequenceNumber();
             auto existPlayerPacket = PacketBuilder::makeNewPlayer(
-                player->getPlayerId(), playerName, pos.first, pos.second, speed,
-                seq, maxHealth);
+                player.player_id, player.name, player.position.first,
+                player.position.second, player.speed, seq, player.max_health);
 
-            auto buffer =
-                serialization::BitserySerializer::serialize(existPlayerPacket);
-            if (buffer.empty()) {
+            auto buffer = networkManager.acquireSendBuffer();
+            serialization::BitserySerializer::serializeInto(*buffer,
+                                                            existPlayerPacket);
+            if (buffer->empty()) {
               std::cerr << "[ERROR] Failed to serialize existPlayerPacket for "
                            "newPlayerID "
                         << client._player_id << std::endl;
               continue;
             }
 
-            client.addUnacknowledgedPacket(
-                seq, std::make_shared<std::vector<std::uint8_t>>(buffer));
-            networkManager.sendToClient(
-                client._player_id,
-                std::make_shared<std::vector<std::uint8_t>>(buffer));
+            buffer = network::ServerNetworkManager::prepareForWire(buffer);
+            networkManager.sendPrepared(client._route, buffer);
+            client.addUnacknowledgedPacket(seq, buffer);
             game.incrementSequenceNumber();
           }
         }
@@ -125,11 +146,11 @@ namespace broadcast {
        * Broadcast the newly connected player to all other connected
        * clients.
        */
-      static void broadcastAncientPlayerToRoom(
+      static WireBuffer broadcastAncientPlayerToRoom(
           network::ServerNetworkManager &networkManager,
           const std::vector<std::shared_ptr<server::Client>> &roomClients,
           const NewPlayerPacket &packet) {
-        broadcastTo(
+        return broadcastTo(
             networkManager, roomClients, packet,
             [player_id = static_cast<int>(packet.player_id)](
                 const auto &client) { return client._player_id != player_id; });
@@ -146,41 +167,41 @@ namespace broadcast {
        * connected clients will receive the packet.
        * @param packet Player movement information to forward to the room.
        */
-      static void broadcastPlayerMoveToRoom(
+      static WireBuffer broadcastPlayerMoveToRoom(
           network::ServerNetworkManager &networkManager,
           const std::vector<std::shared_ptr<server::Client>> &roomClients,
           const PlayerMovePacket &packet) {
-        broadcastToRoom(networkManager, roomClients, packet);
+        return broadcastToRoom(networkManager, roomClients, packet);
       }
 
       /*
        * Broadcast the player shoot to all other connected clients.
        */
-      static void broadcastPlayerShootToRoom(
+      static WireBuffer broadcastPlayerShootToRoom(
           network::ServerNetworkManager &networkManager,
           const std::vector<std::shared_ptr<server::Client>> &roomClients,
           const PlayerShootPacket &packet) {
-        broadcastToRoom(networkManager, roomClients, packet);
+        return broadcastToRoom(networkManager, roomClients, packet);
       }
 
       /*
        * Broadcast the enemy spawned to all connected clients.
        */
-      static void broadcastEnemySpawnToRoom(
+      static WireBuffer broadcastEnemySpawnToRoom(
           network::ServerNetworkManager &networkManager,
           const std::vector<std::shared_ptr<server::Client>> &roomClients,
           const EnemySpawnPacket &packet) {
-        broadcastToRoom(networkManager, roomClients, packet);
+        return broadcastToRoom(networkManager, roomClients, packet);
       }
 
       /*
        * Broadcast the enemy moved to all connected clients.
        */
-      static void broadcastEnemyMoveToRoom(
+      static WireBuffer broadcastEnemyMoveToRoom(
           network::ServerNetworkManager &networkManager,
           const std::vector<std::shared_ptr<server::Client>> &roomClients,
           const EnemyMovePacket &packet) {
-        broadcastToRoom(networkManager, roomClients, packet);
+        return broadcastToRoom(networkManager, roomClients, packet);
       }
 
       /**
@@ -191,11 +212,11 @@ namespace broadcast {
        * are connected will receive the packet.
        * @param packet Enemy death event packet to send to clients.
        */
-      static void broadcastEnemyDeathToRoom(
+      static WireBuffer broadcastEnemyDeathToRoom(
           network::ServerNetworkManager &networkManager,
           const std::vector<std::shared_ptr<server::Client>> &roomClients,
           const EnemyDeathPacket &packet) {
-        broadcastToRoom(networkManager, roomClients, packet);
+        return broadcastToRoom(networkManager, roomClients, packet);
       }
 
       /**
@@ -204,51 +225,51 @@ namespace broadcast {
        * @param packet Packet describing which enemy was hit and associated hit
        * data.
        */
-      static void broadcastEnemyHitToRoom(
+      static WireBuffer broadcastEnemyHitToRoom(
           network::ServerNetworkManager &networkManager,
           const std::vector<std::shared_ptr<server::Client>> &roomClients,
           const EnemyHitPacket &packet) {
-        broadcastToRoom(networkManager, roomClients, packet);
+        return broadcastToRoom(networkManager, roomClients, packet);
       }
 
       /*
        * Broadcast the projectile spawned to all connected clients.
        */
-      static void broadcastProjectileSpawnToRoom(
+      static WireBuffer broadcastProjectileSpawnToRoom(
           network::ServerNetworkManager &networkManager,
           const std::vector<std::shared_ptr<server::Client>> &roomClients,
           const ProjectileSpawnPacket &packet) {
-        broadcastToRoom(networkManager, roomClients, packet);
+        return broadcastToRoom(networkManager, roomClients, packet);
       }
 
       /*
        * Broadcast the projectile hit to all connected clients.
        */
-      static void broadcastProjectileHitToRoom(
+      static WireBuffer broadcastProjectileHitToRoom(
           network::ServerNetworkManager &networkManager,
           const std::vector<std::shared_ptr<server::Client>> &roomClients,
           const ProjectileHitPacket &packet) {
-        broadcastToRoom(networkManager, roomClients, packet);
+        return broadcastToRoom(networkManager, roomClients, packet);
       }
 
       /*
        * Broadcast the projectile destroyed to all connected clients.
        */
-      static void broadcastProjectileDestroyToRoom(
+      static WireBuffer broadcastProjectileDestroyToRoom(
           network::ServerNetworkManager &networkManager,
           const std::vector<std::shared_ptr<server::Client>> &roomClients,
           const ProjectileDestroyPacket &packet) {
-        broadcastToRoom(networkManager, roomClients, packet);
+        return broadcastToRoom(networkManager, roomClients, packet);
       }
 
       /*
        * Broadcast the game start to all connected clients.
        */
-      static void broadcastGameStartToRoom(
+      static WireBuffer broadcastGameStartToRoom(
           network::ServerNetworkManager &networkManager,
           const std::vector<std::shared_ptr<server::Client>> &roomClients,
           const GameStartPacket &packet) {
-        broadcastToRoom(networkManager, roomClients, packet);
+        return broadcastToRoom(networkManager, roomClients, packet);
       }
 
       /**
@@ -259,11 +280,11 @@ namespace broadcast {
        * connected clients will receive the packet.
        * @param packet GameEndPacket to be sent to recipients.
        */
-      static void broadcastGameEndToRoom(
+      static WireBuffer broadcastGameEndToRoom(
           network::ServerNetworkManager &networkManager,
           const std::vector<std::shared_ptr<server::Client>> &roomClients,
           const GameEndPacket &packet) {
-        broadcastToRoom(networkManager, roomClients, packet);
+        return broadcastToRoom(networkManager, roomClients, packet);
       }
 
       /**
@@ -272,11 +293,11 @@ namespace broadcast {
        * @param packet Packet describing the player's death to send to all
        * clients.
        */
-      static void broadcastPlayerDeathToRoom(
+      static WireBuffer broadcastPlayerDeathToRoom(
           network::ServerNetworkManager &networkManager,
           const std::vector<std::shared_ptr<server::Client>> &roomClients,
           const PlayerDeathPacket &packet) {
-        broadcastToRoom(networkManager, roomClients, packet);
+        return broadcastToRoom(networkManager, roomClients, packet);
       }
 
       /**
@@ -286,11 +307,11 @@ namespace broadcast {
        * @param packet PlayerHitPacket describing the hit event to forward to
        * room members.
        */
-      static void broadcastPlayerHitToRoom(
+      static WireBuffer broadcastPlayerHitToRoom(
           network::ServerNetworkManager &networkManager,
           const std::vector<std::shared_ptr<server::Client>> &roomClients,
           const PlayerHitPacket &packet) {
-        broadcastToRoom(networkManager, roomClients, packet);
+        return broadcastToRoom(networkManager, roomClients, packet);
       }
 
       /**
@@ -302,11 +323,11 @@ namespace broadcast {
        * @param packet Packet describing the disconnect, containing the player
        * id of the disconnecting player.
        */
-      static void broadcastPlayerDisconnectToRoom(
+      static WireBuffer broadcastPlayerDisconnectToRoom(
           network::ServerNetworkManager &networkManager,
           const std::vector<std::shared_ptr<server::Client>> &roomClients,
           const PlayerDisconnectPacket &packet) {
-        broadcastToRoom(networkManager, roomClients, packet);
+        return broadcastToRoom(networkManager, roomClients, packet);
       }
 
       /**
@@ -317,11 +338,11 @@ namespace broadcast {
        *
        * @param packet ChatMessagePacket containing the message to broadcast.
        */
-      static void broadcastMessageToRoom(
+      static WireBuffer broadcastMessageToRoom(
           network::ServerNetworkManager &networkManager,
           const std::vector<std::shared_ptr<server::Client>> &roomClients,
           const ChatMessagePacket &packet) {
-        broadcastToRoom(networkManager, roomClients, packet);
+        return broadcastToRoom(networkManager, roomClients, packet);
       };
 
       /**
@@ -337,14 +358,14 @@ namespace broadcast {
        * @param excluded_player_id Player ID to exclude from receiving the
        * packet.
        */
-      static void broadcastMessageToRoomExcept(
+      static WireBuffer broadcastMessageToRoomExcept(
           network::ServerNetworkManager &networkManager,
           const std::vector<std::shared_ptr<server::Client>> &roomClients,
           const ChatMessagePacket &packet, int excluded_player_id) {
-        broadcastTo(networkManager, roomClients, packet,
-                    [excluded_player_id](const auto &client) {
-                      return client._player_id != excluded_player_id;
-                    });
+        return broadcastTo(networkManager, roomClients, packet,
+                           [excluded_player_id](const auto &client) {
+                             return client._player_id != excluded_player_id;
+                           });
       }
   };
 }  // namespace broadcast
\ No newline at end of file
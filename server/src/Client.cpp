@@ -1,87 +1,153 @@
 #include "Client.hpp"
 #include <chrono>
-#include <unordered_map>
 #include <vector>
 #include "Macro.hpp"
+#include "PacketFragmenter.hpp"
 
 /**
  * @brief Store a packet as unacknowledged for retransmission tracking.
  *
- * Initializes tracking state for the packet identified by sequence_number so it
- * can be retransmitted until acknowledged.
+ * Stores the packet in the client's unacknowledged ring so it can be
+ * retransmitted until acknowledged, and schedules its first retransmission one
+ * RTO from now on the client's resend wheel, under its tracking number.
  *
- * @param sequence_number Sequence number that identifies the packet.
+ * @param sequence_number Sequence number the packet was built with.
  * @param packetData Shared pointer to the packet bytes to retain for
  * retransmission.
  *
  * @note The entry's resend count is initialized to 0 and the last-sent
- * timestamp is recorded as the current steady clock time.
+ * timestamp is recorded as the current steady clock time. A null buffer (a
+ * broadcast that failed to serialize) is not tracked. The buffer is stored
+ * ready for the wire, so retransmissions are sent as is.
+ *
+ * The packet is matched to the datagram that just carried it to this client
+ * through the ack channel's send history; a packet that cannot be matched is
+ * acknowledged from its first retransmission on. A packet too large for one
+ * datagram is only acknowledged once all of its fragments are.
  */
 void server::Client::addUnacknowledgedPacket(
     std::uint32_t sequence_number,
     std::shared_ptr<std::vector<uint8_t>> packetData) {
+  if (!packetData)
+    return;
+  std::optional<std::uint16_t> ackSequence;
+  if (_route.acks)
+    ackSequence = _route.acks->findSent(packetData.get());
+  packetData = network::ServerNetworkManager::prepareForWire(packetData);
+  const auto now = std::chrono::steady_clock::now();
   std::lock_guard<std::mutex> lock(_unacknowledgedPacketsMutex);
   UnacknowledgedPacket packet;
-  packet.data = packetData;
+  packet.data = std::move(packetData);
+  packet.sequence_number = sequence_number;
   packet.resend_count = 0;
-  packet.last_sent = std::chrono::steady_clock::now();
-  _unacknowledged_packets[sequence_number] = packet;
+  packet.last_sent = now;
+  packet.ack_sequence = ackSequence;
+  packet.pending_fragments =
+      network::PacketFragmenter::fragmentMask(packet.data->size());
+  packet.resend_at = now + _rtt.getRto();
+  const auto resendAt = packet.resend_at;
+  _resend_wheel.schedule(resendAt,
+                         _unacknowledged_packets.insert(std::move(packet)));
 }
 
 /**
- * @brief Remove an unacknowledged packet tracked by sequence number.
+ * @brief Process the ack header of a datagram received from this client.
  *
- * If an entry with the given sequence number exists it is erased; if no entry
- * exists the call has no effect.
+ * Records the datagram in the client's ack channel, so the next datagram sent
+ * to the client acknowledges it, and drops every unacknowledged packet whose
+ * last datagram, or every fragment for a fragmented packet, has now been
+ * acknowledged.
  *
- * @param sequence_number Sequence number of the packet to remove.
+ * The most recently sent of the acknowledged packets that were never
+ * retransmitted gives an RTT sample; retransmitted ones are ambiguous and
+ * skipped (Karn's algorithm).
+ *
+ * @param header Ack header read from the received datagram.
  */
-void server::Client::removeAcknowledgedPacket(std::uint32_t sequence_number) {
+void server::Client::handleAckHeader(const network::AckHeader &header) {
+  if (!_route.acks)
+    return;
+  _route.acks->receive(header);
+  const auto now = std::chrono::steady_clock::now();
+  std::optional<std::chrono::steady_clock::duration> sample;
   std::lock_guard<std::mutex> lock(_unacknowledgedPacketsMutex);
-  auto it = _unacknowledged_packets.find(sequence_number);
-  if (it != _unacknowledged_packets.end()) {
-    _unacknowledged_packets.erase(it);
-  }
+  _unacknowledged_packets.eraseIf([&](UnacknowledgedPacket &packet) {
+    if (!packet.ack_sequence)
+      return false;
+    packet.pending_fragments = header.unacknowledged(
+        *packet.ack_sequence, packet.pending_fragments);
+    if (packet.pending_fragments != 0)
+      return false;
+    const auto elapsed = now - packet.last_sent;
+    if (packet.resend_count == 0 && (!sample || elapsed < *sample))
+      sample = elapsed;
+    return true;
+  });
+  if (sample)
+    _rtt.addSample(
+        std::chrono::duration_cast<std::chrono::milliseconds>(*sample));
+}
+
+/**
+ * @brief Retrieve the smoothed round trip the server measured from this
+ * client's acks.
+ *
+ * @return std::chrono::milliseconds The smoothed RTT, or zero before the
+ * first ack-derived sample.
+ */
+std::chrono::milliseconds server::Client::getSmoothedRtt() const {
+  std::lock_guard<std::mutex> lock(_unacknowledgedPacketsMutex);
+  return _rtt.hasSample() ? _rtt.getSmoothedRtt()
+                          : std::chrono::milliseconds(0);
 }
 
 /**
- * @brief Retransmits unacknowledged packets to this client and drops those that
- * exceeded retry limits.
+ * @brief Retransmits the unacknowledged packets whose timeout expired and
+ * drops those that exceeded retry limits.
+ *
+ * Advances the client's resend wheel to now; only packets whose deadline
+ * passed are looked at. Each of them has its resend count incremented, is
+ * sent to the client and is rescheduled one backed-off RTO later (the RTO
+ * doubles with each attempt, up to MAX_RTO_MS). Packets whose resend count
+ * reached MAX_RESEND_ATTEMPTS are removed and not retransmitted; wheel entries
+ * of packets acknowledged meanwhile are ignored.
  *
- * For each stored unacknowledged packet whose last send time is older than
- * MIN_RESEND_PACKET_DELAY, increments its resend count and sends it to the
- * client; packets whose resend count is greater than or equal to
- * MAX_RESEND_ATTEMPTS are removed and not retransmitted.
+ * Each retransmission is sent in a new datagram, or new fragments, whose ack
+ * sequence replaces the packet's previous one.
  *
  * @param networkManager Server network manager used to send packets to the
  * client.
  */
 void server::Client::resendUnacknowledgedPackets(
     network::ServerNetworkManager &networkManager) {
-  const auto MIN_RESEND_INTERVAL =
-      std::chrono::milliseconds(MIN_RESEND_PACKET_DELAY);
   const auto now = std::chrono::steady_clock::now();
 
-  std::vector<std::shared_ptr<std::vector<uint8_t>>> toSend;
-  std::vector<uint32_t> toDrop;
+  std::vector<std::pair<uint32_t, std::shared_ptr<std::vector<uint8_t>>>>
+      toSend;
   {
     std::lock_guard<std::mutex> lock(_unacknowledgedPacketsMutex);
-    for (auto &[seq, packet] : _unacknowledged_packets) {
-      if (now - packet.last_sent < MIN_RESEND_INTERVAL)
-        continue;
-      if (packet.resend_count >= MAX_RESEND_ATTEMPTS) {
-        toDrop.push_back(seq);
-        continue;
+    _resend_wheel.advance(now, [&](std::uint32_t number) {
+      UnacknowledgedPacket *packet = _unacknowledged_packets.find(number);
+      if (packet == nullptr || packet->resend_at > now)
+        return;
+      if (packet->resend_count >= MAX_RESEND_ATTEMPTS) {
+        _unacknowledged_packets.erase(number);
+        return;
       }
-      packet.resend_count++;
-      packet.last_sent = now;
-      toSend.push_back(packet.data);
-    }
-    for (auto seq : toDrop) {
-      _unacknowledged_packets.erase(seq);
-    }
+      packet->resend_count++;
+      packet->last_sent = now;
+      packet->resend_at = now + _rtt.getBackoffRto(packet->resend_count);
+      _resend_wheel.schedule(packet->resend_at, number);
+      toSend.emplace_back(number, packet->data);
+    });
   }
-  for (auto &buf : toSend) {
-    networkManager.sendToClient(_player_id, buf);
+  for (auto &[number, buf] : toSend) {
+    const std::uint16_t ackSequence = networkManager.sendPrepared(_route, buf);
+    std::lock_guard<std::mutex> lock(_unacknowledgedPacketsMutex);
+    if (auto *packet = _unacknowledged_packets.find(number)) {
+      packet->ack_sequence = ackSequence;
+      packet->pending_fragments =
+          network::PacketFragmenter::fragmentMask(buf->size());
+    }
   }
 }
@@ -6,7 +6,10 @@
 #include <limits>
 #include "Macro.hpp"
 #include "PacketUtils.hpp"
+#include "RttEstimator.hpp"
 #include "ServerNetworkManager.hpp"
+#include "TimerWheel.hpp"
+#include "UnacknowledgedRing.hpp"
 
 namespace server {
   enum class ClientState {
@@ -53,11 +56,24 @@ namespace server {
       std::chrono::steady_clock::time_point _last_heartbeat;
       std::chrono::steady_clock::time_point _last_position_update;
       std::uint32_t _entity_id = std::numeric_limits<std::uint32_t>::max();
+      network::ClientRoute _route;
 
+      /**
+       * @brief Sequences everything that mutates this client's session:
+       * packet handlers, timeout and slot release. Packets from different
+       * clients are handled in parallel; packets from one client never are.
+       */
+      mutable std::mutex _stateMutex;
       mutable std::mutex _unacknowledgedPacketsMutex;
 
-      std::unordered_map<std::uint32_t, UnacknowledgedPacket>
-          _unacknowledged_packets;
+      /**
+       * @brief Reliable packets awaiting acknowledgement, their
+       * retransmission deadlines (by tracking number) and the round-trip
+       * estimate they derive from, all guarded by _unacknowledgedPacketsMutex.
+       */
+      network::UnacknowledgedRing _unacknowledged_packets;
+      network::RttEstimator _rtt;
+      network::TimerWheel<std::uint32_t> _resend_wheel;
 
       void resendUnacknowledgedPackets(
           network::ServerNetworkManager &networkManager);
@@ -65,6 +81,7 @@ namespace server {
       void addUnacknowledgedPacket(
           std::uint32_t sequence_number,
           std::shared_ptr<std::vector<uint8_t>> packetData);
-      void removeAcknowledgedPacket(std::uint32_t sequence_number);
+      void handleAckHeader(const network::AckHeader &header);
+      std::chrono::milliseconds getSmoothedRtt() const;
   };
 }  // namespace server
@@ -0,0 +1,154 @@
+#include "ReplicationScheduler.hpp"
+#include <algorithm>
+#include <functional>
+
+/**
+ * @brief Offer the latest position of a player, replacing the one offered
+ * earlier in the same drain. Also tells how far enemies are from the
+ * player's client.
+ *
+ * @param buffer PlayerMove packet, ready for the wire.
+ */
+void server::ReplicationScheduler::offerPlayerMove(int player_id, float x,
+                                                   float y,
+                                                   WireBuffer buffer) {
+  if (!buffer)
+    return;
+  _playerPositions[player_id] = {x, y};
+  _offered[keyOf(true, player_id)] = {true, player_id, x, y,
+                                      std::move(buffer)};
+}
+
+/**
+ * @brief Offer the latest state of an enemy, replacing the one offered earlier
+ * in the same drain.
+ *
+ * @param buffer EnemyMove packet, ready for the wire.
+ */
+void server::ReplicationScheduler::offerEnemyMove(int enemy_id, float x,
+                                                  float y, WireBuffer buffer) {
+  if (!buffer)
+    return;
+  _offered[keyOf(false, enemy_id)] = {false, enemy_id, x, y,
+                                      std::move(buffer)};
+}
+
+/**
+ * @brief Drop the state updates still waiting for a destroyed enemy, so they
+ * are not sent after its death.
+ */
+void server::ReplicationScheduler::forgetEnemy(int enemy_id) {
+  const std::uint64_t key = keyOf(false, enemy_id);
+  _offered.erase(key);
+  for (auto &[player_id, queue] : _queues)
+    queue.erase(key);
+}
+
+/**
+ * @brief Merge the updates offered since the last flush into the queue of
+ * each client of the room and send what their budgets allow.
+ *
+ * Queues of clients that left the room are dropped, and so are the queued
+ * moves of players who left it.
+ *
+ * @param networkManager Network manager the updates are sent with.
+ * @param clients Snapshot of the room's clients.
+ */
+void server::ReplicationScheduler::flush(
+    network::ServerNetworkManager &networkManager,
+    const std::vector<std::shared_ptr<Client>> &clients) {
+  std::vector<int> present;
+  present.reserve(clients.size());
+  for (const auto &client : clients)
+    if (client && client->_connected &&
+        static_cast<std::uint32_t>(client->_player_id) != INVALID_ID)
+      present.push_back(client->_player_id);
+
+  const auto isPresent = [&present](int player_id) {
+    return std::find(present.begin(), present.end(), player_id) !=
+           present.end();
+  };
+  std::erase_if(_queues,
+                [&](const auto &entry) { return !isPresent(entry.first); });
+  std::erase_if(_playerPositions,
+                [&](const auto &entry) { return !isPresent(entry.first); });
+
+  for (const auto &client : clients)
+    if (client && client->_connected &&
+        static_cast<std::uint32_t>(client->_player_id) != INVALID_ID)
+      flushClient(networkManager, *client, present);
+  _offered.clear();
+}
+
+/**
+ * @brief Queue the offered updates for one client, raise the priority of
+ * everything queued and send the highest-priority updates that fit in the
+ * client's budget.
+ */
+void server::ReplicationScheduler::flushClient(
+    network::ServerNetworkManager &networkManager, Client &client,
+    const std::vector<int> &present) {
+  Queue &queue = _queues[client._player_id];
+  for (const auto &[key, update] : _offered)
+    queue[key].update = update;
+  if (queue.empty())
+    return;
+
+  _order.clear();
+  for (auto it = queue.begin(); it != queue.end();) {
+    Pending &pending = it->second;
+    if (pending.update.player &&
+        std::find(present.begin(), present.end(), pending.update.id) ==
+            present.end()) {
+      it = queue.erase(it);
+      continue;
+    }
+    pending.priority +=
+        weightOf(classify(pending.update, client._player_id));
+    _order.emplace_back(pending.priority, it->first);
+    ++it;
+  }
+  std::sort(_order.begin(), _order.end(), std::greater<>());
+
+  for (const auto &[priority, key] : _order) {
+    auto it = queue.find(key);
+    const WireBuffer &buffer = it->second.update.buffer;
+    if (client._route.budget &&
+        client._route.budget->available() <
+            static_cast<std::int64_t>(ACK_HEADER_SIZE + buffer->size()))
+      break;
+    networkManager.sendPrepared(client._route, buffer);
+    queue.erase(it);
+  }
+}
+
+/**
+ * @brief Class of an update as seen by the client of `viewer_id`: enemies
+ * within NEAR_DISTANCE of its player are near, and so are all enemies while
+ * its player's position is unknown.
+ */
+server::UpdateClass server::ReplicationScheduler::classify(
+    const Update &update, int viewer_id) const {
+  if (update.player)
+    return UpdateClass::PLAYER_MOVE;
+  auto it = _playerPositions.find(viewer_id);
+  if (it == _playerPositions.end())
+    return UpdateClass::NEAR_ENEMY_MOVE;
+  const float dx = update.x - it->second.first;
+  const float dy = update.y - it->second.second;
+  return dx * dx + dy * dy <= NEAR_DISTANCE * NEAR_DISTANCE
+             ? UpdateClass::NEAR_ENEMY_MOVE
+             : UpdateClass::FAR_ENEMY_MOVE;
+}
+
+float server::ReplicationScheduler::weightOf(UpdateClass updateClass) {
+  switch (updateClass) {
+    case UpdateClass::PLAYER_MOVE:
+      return PLAYER_MOVE_WEIGHT;
+    case UpdateClass::NEAR_ENEMY_MOVE:
+      return NEAR_ENEMY_WEIGHT;
+    case UpdateClass::FAR_ENEMY_MOVE:
+      return FAR_ENEMY_WEIGHT;
+  }
+  return FAR_ENEMY_WEIGHT;
+}
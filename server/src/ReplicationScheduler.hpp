@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "Client.hpp"
+#include "Macro.hpp"
+#include "ServerNetworkManager.hpp"
+
+namespace server {
+
+  /**
+   * @brief Class of a deferrable state update, which sets how fast its
+   * priority grows while it waits.
+   */
+  enum class UpdateClass {
+    PLAYER_MOVE,
+    NEAR_ENEMY_MOVE,
+    FAR_ENEMY_MOVE
+  };
+
+  /**
+   * @brief Fits a room's unreliable state updates (player and enemy moves)
+   * into the send budget of each of its clients.
+   *
+   * Updates offered during an event drain are coalesced per entity, only the
+   * latest state being kept, and merged into a queue per client. On flush()
+   * every queued update gains the weight of its class, relative to the
+   * client's own player, and the queue is sent in decreasing priority order
+   * until the client's budget runs out; the rest waits for the next drain,
+   * keeping the priority it accumulated, so updates that lose once win later
+   * and nothing starves. A sent update starts over from zero.
+   *
+   * Reliable events are not scheduled: they are sent as they come and
+   * charged to the same budget, so a burst of them holds state updates back
+   * first.
+   *
+   * Only used on the room's network thread; not synchronized.
+   */
+  class ReplicationScheduler {
+    public:
+      using WireBuffer = std::shared_ptr<std::vector<std::uint8_t>>;
+
+      void offerPlayerMove(int player_id, float x, float y,
+                           WireBuffer buffer);
+      void offerEnemyMove(int enemy_id, float x, float y, WireBuffer buffer);
+      void forgetEnemy(int enemy_id);
+      void flush(network::ServerNetworkManager &networkManager,
+                 const std::vector<std::shared_ptr<Client>> &clients);
+
+    private:
+      static constexpr float PLAYER_MOVE_WEIGHT = 4.0f;
+      static constexpr float NEAR_ENEMY_WEIGHT = 2.0f;
+      static constexpr float FAR_ENEMY_WEIGHT = 1.0f;
+      static constexpr float NEAR_DISTANCE = WINDOW_WIDTH / 2.0f;
+
+      struct Update {
+          bool player = false;
+          int id = 0;
+          float x = 0.0f;
+          float y = 0.0f;
+          WireBuffer buffer;
+      };
+
+      struct Pending {
+          Update update;
+          float priority = 0.0f;
+      };
+
+      using Queue = std::unordered_map<std::uint64_t, Pending>;
+
+      static std::uint64_t keyOf(bool player, int id) {
+        return (static_cast<std::uint64_t>(player) << 32) |
+               static_cast<std::uint32_t>(id);
+      }
+
+      UpdateClass classify(const Update &update, int viewer_id) const;
+      static float weightOf(UpdateClass updateClass);
+      void flushClient(network::ServerNetworkManager &networkManager,
+                       Client &client, const std::vector<int> &present);
+
+      std::unordered_map<std::uint64_t, Update> _offered;
+      std::unordered_map<int, Queue> _queues;
+      std::unordered_map<int, std::pair<float, float>> _playerPositions;
+      std::vector<std::pair<float, std::uint64_t>> _order;
+  };
+
+}  // namespace server
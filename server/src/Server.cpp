@@ -13,31 +13,54 @@
 #include "IPacket.hpp"
 #include "Macro.hpp"
 #include "Packet.hpp"
+#include "PacketBundle.hpp"
 #include "PacketCompressor.hpp"
 
 /**
  * @brief Initialize a Server bound to the given UDP port with client limits.
  *
  * Sets up network manager, counters, and game manager for per-room limits,
- * resizes internal client storage, and starts a background resend thread
- * responsible for periodically resending unacknowledged packets.
+ * sizes the client slots and their lookup tables, and starts a background
+ * resend thread responsible for periodically resending unacknowledged packets.
  *
  * @param port UDP port the server will bind to for network communication.
  * @param max_clients Maximum total concurrent clients the server will accept.
  * @param max_clients_per_room Maximum number of clients allowed in a single
  * game room.
+ * @param record_directory Directory where room recordings are written; empty
+ * to disable recording.
+ * @param network_threads Number of SO_REUSEPORT sockets opened on `port`, each
+ * with its own network thread.
+ * @param aggregation_mtu Size cap of the datagrams bundling several packets
+ * for clients that negotiated it; 0 disables bundling.
+ * @param client_send_rate Bytes per second sent to each client before its
+ * state updates are deferred; 0 means unlimited.
  */
-server::Server::Server(std::uint16_t port, std::uint8_t max_clients,
-                       std::uint8_t max_clients_per_room)
-    : _networkManager(port),
+server::Server::Server(std::uint16_t port, std::uint16_t max_clients,
+                       std::uint8_t max_clients_per_room,
+                       const std::string &record_directory,
+                       std::size_t network_threads,
+                       std::size_t aggregation_mtu,
+                       std::size_t client_send_rate)
+    : _networkManager(port, true, network_threads),
       _max_clients(max_clients),
       _max_clients_per_room(max_clients_per_room),
       _port(port),
       _player_count(0),
       _next_player_id(0),
       _projectile_count(0) {
-  _gameManager = std::make_shared<game::GameManager>(_max_clients_per_room);
-  _clients.resize(_max_clients);
+  _networkManager.setAggregationMtu(aggregation_mtu);
+  _networkManager.setClientSendRate(client_send_rate);
+  _gameManager = std::make_shared<game::GameManager>(_max_clients_per_room,
+                                                     record_directory);
+  auto table = std::make_shared<ClientTable>();
+  table->slots.resize(_max_clients);
+  table->slot_by_id.assign(_max_clients, NO_CLIENT_SLOT);
+  table->slot_by_endpoint.reserve(_max_clients);
+  _clientTable.store(std::move(table), std::memory_order_release);
+  _freeClientSlots.reserve(_max_clients);
+  for (std::size_t slot = _max_clients; slot-- > 0;)
+    _freeClientSlots.push_back(slot);
   _databaseManager = std::make_shared<database::DatabaseManager>();
   if (!_databaseManager->initialize()) {
     std::cerr << "[ERROR] Failed to initialize database manager." << std::endl;
@@ -55,7 +78,7 @@ server::Server::Server(std::uint16_t port, std::uint8_t max_clients,
  * periodic tasks:
  * - processGameEvents (every 50 ms)
  * - handleTimeout (every 1 s)
- * - handleUnacknowledgedPackets (every RESEND_PACKET_DELAY ms)
+ * - handleUnacknowledgedPackets (every RESEND_WHEEL_TICK_MS ms)
  * - clearLastProcessedSeq (every 2 s)
  */
 void server::Server::start() {
@@ -78,7 +101,7 @@ void server::Server::start() {
   _networkManager.scheduleTimeout(std::chrono::seconds(1),
                                   [this]() { handleTimeout(); });
   _networkManager.scheduleUnacknowledgedPacketsCheck(
-      std::chrono::milliseconds(RESEND_PACKET_DELAY),
+      std::chrono::milliseconds(RESEND_WHEEL_TICK_MS),
       [this]() { handleUnacknowledgedPackets(); });
 
   _networkManager.scheduleClearLastProcessedSeq(
@@ -104,7 +127,9 @@ void server::Server::stop() {
  * @brief Detects clients that have been inactive longer than CLIENT_TIMEOUT and
  * disconnects them.
  *
- * For each timed-out client this function marks the client as disconnected,
+ * Works on a snapshot of the client table and takes each client's own lock,
+ * so packets from other clients keep being handled meanwhile. For each
+ * timed-out client this function marks the client as disconnected,
  * decrements the server player count, updates the player's online status in the
  * database, and clears the client slot. If the client was in a room, it also
  * notifies the room by broadcasting a player-disconnect packet and a chat
@@ -113,15 +138,13 @@ void server::Server::stop() {
  */
 void server::Server::handleTimeout() {
   auto now = std::chrono::steady_clock::now();
+  auto table = getClientTable();
 
-  std::lock_guard<std::shared_mutex> lock(_clientsMutex);
-  if (_clients.empty()) {
-    return;
-  }
-
-  for (std::size_t i = 0; i < _clients.size(); ++i) {
-    auto &client = _clients[i];
-    if (!client || !client->_connected)
+  for (const auto &client : table->slots) {
+    if (!client)
+      continue;
+    std::unique_lock<std::mutex> clientLock(client->_stateMutex);
+    if (!client->_connected)
       continue;
     auto duration = std::chrono::duration_cast<std::chrono::seconds>(
         now - client->_last_heartbeat);
@@ -148,10 +171,9 @@ void server::Server::handleTimeout() {
           auto &game = room->getGame();
           auto disconnectPacket = PacketBuilder::makePlayerDisconnect(
               pid, game.fetchAndIncrementSequenceNumber());
-          auto disconnectBuffer = std::make_shared<std::vector<std::uint8_t>>(
-              serialization::BitserySerializer::serialize(disconnectPacket));
-          broadcast::Broadcast::broadcastPlayerDisconnectToRoom(
-              _networkManager, roomClients, disconnectPacket);
+          auto disconnectBuffer =
+              broadcast::Broadcast::broadcastPlayerDisconnectToRoom(
+                  _networkManager, roomClients, disconnectPacket);
           for (const auto &roomClient : roomClients) {
             if (roomClient && roomClient->_player_id != pid) {
               roomClient->addUnacknowledgedPacket(
@@ -162,9 +184,7 @@ void server::Server::handleTimeout() {
           auto chatMessagePacket = PacketBuilder::makeChatMessage(
               msg, SERVER_SENDER_ID, 255, 0, 0, 255,
               game.fetchAndIncrementSequenceNumber());
-          auto chatMessageBuffer = std::make_shared<std::vector<std::uint8_t>>(
-              serialization::BitserySerializer::serialize(chatMessagePacket));
-          broadcast::Broadcast::broadcastMessageToRoom(
+          auto chatMessageBuffer = broadcast::Broadcast::broadcastMessageToRoom(
               _networkManager, roomClients, chatMessagePacket);
           for (const auto &roomClient : roomClients) {
             if (roomClient && roomClient->_player_id != pid) {
@@ -172,12 +192,15 @@ void server::Server::handleTimeout() {
                   chatMessagePacket.sequence_number, chatMessageBuffer);
             }
           }
+          if (auto *recorder = room->getGame().getRecorder())
+            recorder->recordLeave(pid);
           room->getGame().destroyPlayer(pid);
           _gameManager->leaveRoom(client);
         }
       }
 
-      client.reset();
+      clientLock.unlock();
+      releaseClientSlot(client);
     }
   }
 }
@@ -189,26 +212,17 @@ void server::Server::handleTimeout() {
  * Converts the provided queue::GameEvent into the corresponding network packet,
  * broadcasts that packet to every client currently in the target room, and
  * enqueues the serialized packet for reliable delivery when applicable.
- *
- * If @p roomId is NO_ROOM or the room cannot be found, the function performs no
- * action.
+ * Player and enemy moves are handed to the room's replication scheduler
+ * instead, which sends them once the drain is over, as the clients' send
+ * budgets allow.
  *
  * @param event Variant holding the specific game event to translate and send.
- * @param roomId Identifier of the target room whose clients will receive the
- * packet.
+ * @param room Room the event was produced by.
+ * @param clients Snapshot of the room's clients, taken once per drain.
  */
-void server::Server::handleGameEvent(const queue::GameEvent &event,
-                                     std::uint32_t roomId) {
-  if (roomId == NO_ROOM) {
-    return;
-  }
-  auto room = _gameManager->getRoom(roomId);
-  if (!room) {
-    return;
-  }
-
-  auto clients = room->getClients();
-
+void server::Server::handleGameEvent(
+    const queue::GameEvent &event, const std::shared_ptr<game::GameRoom> &room,
+    const std::vector<std::shared_ptr<Client>> &clients) {
   std::visit(
       [this, &clients, &room](const auto &specificEvent) {
         using T = std::decay_t<decltype(specificEvent)>;
@@ -219,10 +233,8 @@ void server::Server::handleGameEvent(const queue::GameEvent &event,
               specificEvent.y, specificEvent.vx, specificEvent.vy,
               specificEvent.health, specificEvent.max_health,
               specificEvent.sequence_number);
-          broadcast::Broadcast::broadcastEnemySpawnToRoom(
+          auto buffer = broadcast::Broadcast::broadcastEnemySpawnToRoom(
               _networkManager, clients, enemySpawnPacket);
-          auto buffer = std::make_shared<std::vector<uint8_t>>(
-              serialization::BitserySerializer::serialize(enemySpawnPacket));
           for (const auto &client : clients)
             client->addUnacknowledgedPacket(specificEvent.sequence_number,
                                             buffer);
@@ -231,10 +243,9 @@ void server::Server::handleGameEvent(const queue::GameEvent &event,
               specificEvent.enemy_id, specificEvent.x, specificEvent.y,
               specificEvent.player_id, specificEvent.score,
               specificEvent.sequence_number);
-          broadcast::Broadcast::broadcastEnemyDeathToRoom(
+          room->getReplicationScheduler().forgetEnemy(specificEvent.enemy_id);
+          auto buffer = broadcast::Broadcast::broadcastEnemyDeathToRoom(
               _networkManager, clients, enemyDeathPacket);
-          auto buffer = std::make_shared<std::vector<uint8_t>>(
-              serialization::BitserySerializer::serialize(enemyDeathPacket));
           for (const auto &client : clients)
             client->addUnacknowledgedPacket(specificEvent.sequence_number,
                                             buffer);
@@ -242,10 +253,8 @@ void server::Server::handleGameEvent(const queue::GameEvent &event,
           auto enemyHitPacket = PacketBuilder::makeEnemyHit(
               specificEvent.enemy_id, specificEvent.x, specificEvent.y,
               specificEvent.damage, specificEvent.sequence_number);
-          broadcast::Broadcast::broadcastEnemyHitToRoom(
+          auto buffer = broadcast::Broadcast::broadcastEnemyHitToRoom(
               _networkManager, clients, enemyHitPacket);
-          auto buffer = std::make_shared<std::vector<uint8_t>>(
-              serialization::BitserySerializer::serialize(enemyHitPacket));
           for (const auto &client : clients)
             client->addUnacknowledgedPacket(specificEvent.sequence_number,
                                             buffer);
@@ -254,19 +263,17 @@ void server::Server::handleGameEvent(const queue::GameEvent &event,
               specificEvent.enemy_id, specificEvent.x, specificEvent.y,
               specificEvent.vx, specificEvent.vy,
               specificEvent.sequence_number);
-          broadcast::Broadcast::broadcastEnemyMoveToRoom(
-              _networkManager, clients, enemyMovePacket);
+          room->getReplicationScheduler().offerEnemyMove(
+              specificEvent.enemy_id, specificEvent.x, specificEvent.y,
+              broadcast::Broadcast::prepare(_networkManager, enemyMovePacket));
         } else if constexpr (std::is_same_v<T, queue::ProjectileSpawnEvent>) {
           auto projectileSpawnPacket = PacketBuilder::makeProjectileSpawn(
               specificEvent.projectile_id, specificEvent.type, specificEvent.x,
               specificEvent.y, specificEvent.vx, specificEvent.vy,
               specificEvent.is_enemy_projectile, specificEvent.damage,
               specificEvent.owner_id, specificEvent.sequence_number);
-          broadcast::Broadcast::broadcastProjectileSpawnToRoom(
+          auto buffer = broadcast::Broadcast::broadcastProjectileSpawnToRoom(
               _networkManager, clients, projectileSpawnPacket);
-          auto buffer = std::make_shared<std::vector<uint8_t>>(
-              serialization::BitserySerializer::serialize(
-                  projectileSpawnPacket));
           for (const auto &client : clients)
             client->addUnacknowledgedPacket(specificEvent.sequence_number,
                                             buffer);
@@ -274,10 +281,8 @@ void server::Server::handleGameEvent(const queue::GameEvent &event,
           auto playerHitPacket = PacketBuilder::makePlayerHit(
               specificEvent.player_id, specificEvent.damage, specificEvent.x,
               specificEvent.y, specificEvent.sequence_number);
-          broadcast::Broadcast::broadcastPlayerHitToRoom(
+          auto buffer = broadcast::Broadcast::broadcastPlayerHitToRoom(
               _networkManager, clients, playerHitPacket);
-          auto buffer = std::make_shared<std::vector<uint8_t>>(
-              serialization::BitserySerializer::serialize(playerHitPacket));
           for (const auto &client : clients)
             client->addUnacknowledgedPacket(specificEvent.sequence_number,
                                             buffer);
@@ -285,11 +290,8 @@ void server::Server::handleGameEvent(const queue::GameEvent &event,
           auto projectileDestroyPacket = PacketBuilder::makeProjectileDestroy(
               specificEvent.projectile_id, specificEvent.x, specificEvent.y,
               specificEvent.sequence_number);
-          broadcast::Broadcast::broadcastProjectileDestroyToRoom(
+          auto buffer = broadcast::Broadcast::broadcastProjectileDestroyToRoom(
               _networkManager, clients, projectileDestroyPacket);
-          auto buffer = std::make_shared<std::vector<uint8_t>>(
-              serialization::BitserySerializer::serialize(
-                  projectileDestroyPacket));
           for (const auto &client : clients)
             client->addUnacknowledgedPacket(specificEvent.sequence_number,
                                             buffer);
@@ -297,10 +299,8 @@ void server::Server::handleGameEvent(const queue::GameEvent &event,
           auto playerDestroyPacket = PacketBuilder::makePlayerDeath(
               specificEvent.player_id, specificEvent.x, specificEvent.y,
               specificEvent.sequence_number);
-          broadcast::Broadcast::broadcastPlayerDeathToRoom(
+          auto buffer = broadcast::Broadcast::broadcastPlayerDeathToRoom(
               _networkManager, clients, playerDestroyPacket);
-          auto buffer = std::make_shared<std::vector<uint8_t>>(
-              serialization::BitserySerializer::serialize(playerDestroyPacket));
           for (const auto &client : clients) {
             client->addUnacknowledgedPacket(specificEvent.sequence_number,
                                             buffer);
@@ -316,15 +316,14 @@ void server::Server::handleGameEvent(const queue::GameEvent &event,
           auto positionPacket = PacketBuilder::makePlayerMove(
               specificEvent.player_id, specificEvent.sequence_number,
               specificEvent.x, specificEvent.y);
-          broadcast::Broadcast::broadcastPlayerMoveToRoom(
-              _networkManager, clients, positionPacket);
+          room->getReplicationScheduler().offerPlayerMove(
+              specificEvent.player_id, specificEvent.x, specificEvent.y,
+              broadcast::Broadcast::prepare(_networkManager, positionPacket));
         } else if constexpr (std::is_same_v<T, queue::GameStartEvent>) {
           GameStartPacket gameStartPacket = PacketBuilder::makeGameStart(
               specificEvent.game_started, specificEvent.sequence_number);
-          broadcast::Broadcast::broadcastGameStartToRoom(
+          auto buffer = broadcast::Broadcast::broadcastGameStartToRoom(
               _networkManager, clients, gameStartPacket);
-          auto buffer = std::make_shared<std::vector<uint8_t>>(
-              serialization::BitserySerializer::serialize(gameStartPacket));
           for (const auto &client : clients) {
             client->addUnacknowledgedPacket(specificEvent.sequence_number,
                                             buffer);
@@ -375,46 +374,85 @@ void server::Server::startReceive() {
 }
 
 /**
- * @brief Process a received network packet and dispatch it to the appropriate
- * handler.
+ * @brief Process a received datagram and dispatch its packets to the
+ * appropriate handlers.
+ *
+ * Strips the ack header every datagram starts with and hands it to the
+ * sending client, which drops the reliable packets it acknowledges; datagrams
+ * holding nothing else stop there. The rest is either one packet or a
+ * PacketBundle, whose packets are handed to handlePacket() in order.
  *
- * Parses the packet header; if the packet is a PlayerInfo packet it handles
- * player connection setup, otherwise it resolves the sender to an existing
- * client and forwards the packet for client-specific processing. If header
- * deserialization fails or the sender cannot be resolved to a connected client,
- * the packet is ignored.
+ * The datagram is not copied: header parsing and the handlers read straight
+ * from the receive buffer, or from the thread's decompression scratch buffer
+ * for compressed packets.
  *
  * @param data Pointer to the received data buffer.
  * @param bytes_transferred Number of bytes available in the buffer.
  */
 void server::Server::handleReceive(const char *data,
                                    std::size_t bytes_transferred) {
-  std::vector<std::uint8_t> packetData(
-      reinterpret_cast<const std::uint8_t *>(data),
-      reinterpret_cast<const std::uint8_t *>(data) + bytes_transferred);
-
-  if (compression::Compressor::isCompressed(packetData)) {
-    auto originalSize = packetData.size();
-    auto decompressed = compression::Compressor::decompress(packetData);
-    if (decompressed.size() == originalSize &&
-        compression::Compressor::isCompressed(decompressed)) {
-      std::cerr << "[WARNING] Decompression may have failed, treating as "
-                   "compressed data"
+  network::AckHeader ackHeader;
+  if (!network::AckHeader::read(data, bytes_transferred, ackHeader)) {
+    std::cerr << "[WARNING] Datagram too small for an ack header, dropping"
+              << std::endl;
+    return;
+  }
+  auto client = findExistingClient();
+  if (client)
+    client->handleAckHeader(ackHeader);
+  if (bytes_transferred == ACK_HEADER_SIZE)
+    return;
+
+  serialization::ByteView payload = serialization::asBytes(
+      data + ACK_HEADER_SIZE, bytes_transferred - ACK_HEADER_SIZE);
+
+  if (!network::PacketBundle::isBundle(payload)) {
+    handlePacket(client, ackHeader, payload);
+    return;
+  }
+  const bool complete = network::PacketBundle::forEach(
+      payload, [&](serialization::ByteView packet) {
+        if (!client)
+          client = findExistingClient();
+        handlePacket(client, ackHeader, packet);
+      });
+  if (!complete)
+    std::cerr << "[WARNING] Truncated packet bundle, rest dropped"
+              << std::endl;
+}
+
+/**
+ * @brief Dispatch one packet of a received datagram.
+ *
+ * Parses the packet header, decompressing the packet first if needed; if the
+ * packet is a PlayerInfo packet it handles player connection setup, otherwise
+ * it forwards the packet to the sending client for client-specific
+ * processing. If header deserialization fails or the sender cannot be
+ * resolved to a connected client, the packet is ignored.
+ *
+ * @param client Client the datagram came from, null if unknown.
+ * @param ackHeader Ack header of the datagram carrying the packet.
+ * @param packet Packet bytes.
+ */
+void server::Server::handlePacket(const std::shared_ptr<Client> &client,
+                                  const network::AckHeader &ackHeader,
+                                  serialization::ByteView packet) {
+  if (compression::Compressor::isCompressed(packet)) {
+    packet = compression::Compressor::decompressToScratch(packet);
+    if (packet.empty()) {
+      std::cerr << "[WARNING] Decompression failed, dropping packet"
                 << std::endl;
       return;
     }
-    packetData = std::move(decompressed);
-    if (packetData.size() < sizeof(PacketHeader)) {
+    if (packet.size() < sizeof(PacketHeader)) {
       std::cerr << "[ERROR] Packet too small after decompression, dropping"
                 << std::endl;
       return;
     }
   }
 
-  serialization::Buffer buffer(packetData.begin(), packetData.end());
-
   auto headerOpt =
-      serialization::BitserySerializer::deserialize<PacketHeader>(buffer);
+      serialization::BitserySerializer::deserialize<PacketHeader>(packet);
 
   if (!headerOpt) {
     std::cerr << "[WARNING] Failed to deserialize packet header" << std::endl;
@@ -422,19 +460,17 @@ void server::Server::handleReceive(const char *data,
   }
 
   PacketHeader header = headerOpt.value();
+  const char *packetData = reinterpret_cast<const char *>(packet.data());
 
   if (header.type == PacketType::PlayerInfo) {
-    handlePlayerInfoPacket(reinterpret_cast<const char *>(packetData.data()),
-                           packetData.size());
+    if (!client)
+      handlePlayerInfoPacket(ackHeader, packetData, packet.size());
     return;
   }
 
-  int client_idx = findExistingClient();
-  if (client_idx == KO)
+  if (!client)
     return;
-  handleClientData(client_idx,
-                   reinterpret_cast<const char *>(packetData.data()),
-                   packetData.size());
+  handleClientData(client, header, packetData, packet.size());
 }
 
 /**
@@ -442,129 +478,126 @@ void server::Server::handleReceive(const char *data,
  * its network association.
  *
  * If the remote endpoint is already associated with a connected client this
- * returns without action. Otherwise attempts to allocate an available client
- * slot, assigns a new player ID, marks the client as connected, registers the
- * client endpoint with the network manager, and dispatches the PlayerInfo
- * packet to the corresponding handler. If no client slot is available, the
+ * returns without action. Otherwise, under the client table writer lock,
+ * takes a client slot from the free-slot stack, assigns a new player ID,
+ * marks the client as connected, registers the client endpoint with the
+ * network manager and publishes the updated table.
+ * The datagram's ack header is recorded in the new client's ack channel and
+ * the PlayerInfo packet is then dispatched to its handler outside the writer
+ * lock, under the new client's own lock. If no client slot is available, the
  * connection is refused and a warning is logged.
  *
+ * @param ackHeader Ack header of the datagram carrying the packet.
  * @param data Pointer to the received PlayerInfo packet buffer.
  * @param size Length in bytes of the packet buffer.
  */
-void server::Server::handlePlayerInfoPacket(const char *data,
-                                            std::size_t size) {
+void server::Server::handlePlayerInfoPacket(
+    const network::AckHeader &ackHeader, const char *data, std::size_t size) {
   auto current_endpoint = _networkManager.getRemoteEndpoint();
-  std::shared_ptr<Client> newClient;
+  if (getClientTable()->slot_by_endpoint.contains(current_endpoint)) {
+    return;
+  }
+
+  if (_databaseManager &&
+      _databaseManager->isIpBanned(current_endpoint.address().to_string())) {
+    std::cerr << "[WARNING] Refused connection from banned IP "
+              << current_endpoint.address().to_string() << std::endl;
+    return;
+  }
 
+  std::shared_ptr<Client> client;
   {
-    std::lock_guard<std::shared_mutex> lock(_clientsMutex);
-    for (size_t i = 0; i < _clients.size(); ++i) {
-      if (_clients[i] && _clients[i]->_connected &&
-          _networkManager.getClientEndpoint(_clients[i]->_player_id) ==
-              current_endpoint) {
-        return;
-      }
+    std::lock_guard<std::mutex> lock(_clientsMutex);
+    auto current = _clientTable.load(std::memory_order_acquire);
+    if (current->slot_by_endpoint.contains(current_endpoint)) {
+      return;
     }
-
-    if (_databaseManager &&
-        _databaseManager->isIpBanned(current_endpoint.address().to_string())) {
-      std::cerr << "[WARNING] Refused connection from banned IP "
+    if (_freeClientSlots.empty()) {
+      std::cerr << "[WARNING] Max clients reached. Refused connection from "
                 << current_endpoint.address().to_string() << std::endl;
       return;
     }
 
-    for (size_t i = 0; i < _clients.size(); ++i) {
-      if (!_clients[i]) {
-        int id = _next_player_id++;
-        _clients[i] = std::make_shared<Client>(id);
-        _clients[i]->_connected = true;
-        _clients[i]->_ip_address = current_endpoint.address().to_string();
-        _player_count++;
-        _networkManager.registerClient(id, current_endpoint);
-
-        std::cout << "[WORLD] New player connecting with ID " << id
-                  << std::endl;
-
-        auto handler = _factory.createHandler(PacketType::PlayerInfo);
-        if (handler) {
-          handler->handlePacket(*this, *_clients[i], data, size);
-        }
-        return;
-      }
-    }
+    const std::size_t slot = _freeClientSlots.back();
+    _freeClientSlots.pop_back();
+    auto table = std::make_shared<ClientTable>(*current);
+    int id = assignPlayerId(*table, slot);
+    client = std::make_shared<Client>(id);
+    client->_connected = true;
+    client->_ip_address = current_endpoint.address().to_string();
+    client->_route = _networkManager.registerClient(id, current_endpoint);
+    table->slots[slot] = client;
+    table->slot_by_endpoint.emplace(current_endpoint, slot);
+    _clientTable.store(std::move(table), std::memory_order_release);
+    _player_count++;
   }
 
-  std::cerr << "[WARNING] Max clients reached. Refused connection from "
-            << current_endpoint.address().to_string() << std::endl;
+  std::cout << "[WORLD] New player connecting with ID " << client->_player_id
+            << std::endl;
+
+  client->handleAckHeader(ackHeader);
+  auto handler = _dispatcher.getHandler(PacketType::PlayerInfo);
+  if (handler) {
+    std::lock_guard<std::mutex> lock(client->_stateMutex);
+    handler(*this, *client, data, size);
+  }
 }
 
 /**
  * @brief Finds the connected client whose registered endpoint matches the
- * current remote endpoint.
+ * current remote endpoint, through the endpoint to slot index of the current
+ * client table snapshot; no lock is taken.
  *
- * If a matching client is found, its last-heartbeat timestamp is updated to
- * now.
- *
- * @return size_t Index of the matching client, or `KO` if no match was found.
+ * @return std::shared_ptr<server::Client> The matching client, or `nullptr`
+ * if no connected client uses that endpoint.
  */
-size_t server::Server::findExistingClient() {
+std::shared_ptr<server::Client> server::Server::findExistingClient() {
   auto current_endpoint = _networkManager.getRemoteEndpoint();
-
-  {
-    std::lock_guard<std::shared_mutex> lock(_clientsMutex);
-    for (size_t i = 0; i < _clients.size(); ++i) {
-      if (_clients[i] && _clients[i]->_connected &&
-          _networkManager.getClientEndpoint(_clients[i]->_player_id) ==
-              current_endpoint) {
-        _clients[i]->_last_heartbeat = std::chrono::steady_clock::now();
-        return static_cast<int>(i);
-      }
-    }
+  auto table = getClientTable();
+  auto it = table->slot_by_endpoint.find(current_endpoint);
+  if (it == table->slot_by_endpoint.end()) {
+    return nullptr;
   }
-  return KO;
+  const auto &client = table->slots[it->second];
+  if (!client || !client->_connected) {
+    return nullptr;
+  }
+  return client;
 }
 
 /**
  * @brief Handle and dispatch a packet received from a connected client.
  *
- * Deserializes the packet header from the provided raw buffer, selects an
- * appropriate packet handler based on the header type, and delegates full
- * packet processing to that handler. Logs a warning and returns if the
- * header cannot be deserialized or if no handler exists for the packet type.
+ * Selects an appropriate packet handler based on the already parsed header
+ * type and delegates full packet processing to that handler. Logs a warning
+ * and returns if no handler exists for the packet type.
+ *
+ * The handler runs under the client's own lock only: packets from one client
+ * are handled one at a time, packets from different clients in parallel on
+ * the network threads. The client's last-heartbeat timestamp is refreshed
+ * under the same lock.
  *
- * @param client_idx Index of the client in the server's client storage.
+ * @param client Client the packet came from.
+ * @param header Header parsed from `data` by handleReceive().
  * @param data Pointer to the raw packet bytes received from the client.
  * @param size Number of bytes available at `data`.
  */
-void server::Server::handleClientData(std::size_t client_idx, const char *data,
-                                      std::size_t size) {
-  std::lock_guard<std::shared_mutex> lock(_clientsMutex);
-  if (client_idx < 0 || client_idx >= static_cast<size_t>(_clients.size()) ||
-      !_clients[client_idx]) {
+void server::Server::handleClientData(const std::shared_ptr<Client> &client,
+                                      const PacketHeader &header,
+                                      const char *data, std::size_t size) {
+  std::lock_guard<std::mutex> lock(client->_stateMutex);
+  if (!client->_connected) {
     return;
   }
+  client->_last_heartbeat = std::chrono::steady_clock::now();
 
-  auto client = _clients[client_idx];
-
-  serialization::Buffer buffer(data, data + size);
-
-  auto headerOpt =
-      serialization::BitserySerializer::deserialize<PacketHeader>(buffer);
-  if (!headerOpt) {
-    std::cerr << "[WARNING] Failed to deserialize packet header from client "
-              << _clients[client_idx]->_player_id << std::endl;
-    return;
-  }
-
-  PacketHeader header = headerOpt.value();
-
-  auto handler = _factory.createHandler(header.type);
+  auto handler = _dispatcher.getHandler(header.type);
   if (handler) {
-    handler->handlePacket(*this, *client, data, size);
+    handler(*this, *client, data, size);
   } else {
     std::cerr << "[WARNING] Unknown packet type "
               << static_cast<int>(header.type) << " from client "
-              << _clients[client_idx]->_player_id << std::endl;
+              << client->_player_id << std::endl;
   }
 }
 
@@ -618,11 +651,13 @@ bool server::Server::initializePlayerInRoom(Client &client) {
     return false;
   }
 
-  client._entity_id = player->getEntityId();
+  client._entity_id = player->entity_id;
+  if (auto *recorder = room->getGame().getRecorder())
+    recorder->recordJoin(client._player_id, client._player_name);
 
-  std::pair<float, float> pos = player->getPosition();
-  float speed = player->getSpeed();
-  int max_health = player->getMaxHealth().value_or(100);
+  std::pair<float, float> pos = player->position;
+  float speed = player->speed;
+  int max_health = player->max_health;
   auto &game = room->getGame();
 
   // Send packets to client that just connected
@@ -630,12 +665,13 @@ bool server::Server::initializePlayerInRoom(Client &client) {
       client._player_id, client._player_name, pos.first, pos.second, speed,
       game.getSequenceNumber(), max_health);
 
-  auto serializedBuffer = std::make_shared<std::vector<uint8_t>>(
-      serialization::BitserySerializer::serialize(ownPlayerPacket));
+  auto serializedBuffer = network::ServerNetworkManager::prepareForWire(
+      std::make_shared<std::vector<uint8_t>>(
+          serialization::BitserySerializer::serialize(ownPlayerPacket)));
 
-  client.addUnacknowledgedPacket(game.getSequenceNumber(), serializedBuffer);
+  _networkManager.sendPrepared(client._route, serializedBuffer);
 
-  _networkManager.sendToClient(client._player_id, serializedBuffer);
+  client.addUnacknowledgedPacket(game.getSequenceNumber(), serializedBuffer);
 
   auto roomClients = room->getClients();
 
@@ -650,10 +686,7 @@ bool server::Server::initializePlayerInRoom(Client &client) {
       client._player_id, client._player_name, pos.first, pos.second, speed,
       newPlayerSeq, max_health);
 
-  auto newPlayerBuffer = std::make_shared<std::vector<uint8_t>>(
-      serialization::BitserySerializer::serialize(newPlayerPacket));
-
-  broadcast::Broadcast::broadcastAncientPlayerToRoom(
+  auto newPlayerBuffer = broadcast::Broadcast::broadcastAncientPlayerToRoom(
       _networkManager, roomClients, newPlayerPacket);
 
   for (const auto &roomClient : roomClients) {
@@ -674,10 +707,11 @@ bool server::Server::initializePlayerInRoom(Client &client) {
   if (roomClients.size() >= 2 &&
       room->getState() == game::RoomStatus::WAITING) {
     auto timer = std::make_shared<asio::steady_timer>(
-        _networkManager.getIoContext(), std::chrono::seconds(1));
+        _networkManager.getIoContext(room->getShard()),
+        std::chrono::seconds(1));
 
-    room->startCountdown(COUNTDOWN_TIME, timer);
-    handleCountdown(room, timer);
+    if (room->startCountdown(COUNTDOWN_TIME, timer))
+      handleCountdown(room, timer);
   }
 
   std::cout << "[WORLD] Player " << client._player_id << " ("
@@ -719,11 +753,8 @@ void server::Server::handleCountdown(
     auto startPacket =
         PacketBuilder::makeGameStart(true, room->getGame().getSequenceNumber());
 
-    broadcast::Broadcast::broadcastGameStartToRoom(_networkManager, roomClients,
-                                                   startPacket);
-
-    auto buffer = std::make_shared<std::vector<uint8_t>>(
-        serialization::BitserySerializer::serialize(startPacket));
+    auto buffer = broadcast::Broadcast::broadcastGameStartToRoom(
+        _networkManager, roomClients, startPacket);
     for (const auto &client : roomClients) {
       client->addUnacknowledgedPacket(room->getGame().getSequenceNumber(),
                                       buffer);
@@ -771,11 +802,11 @@ void server::Server::handleCountdown(
  */
 std::shared_ptr<server::Client> server::Server::getClient(
     std::size_t idx) const {
-  std::shared_lock<std::shared_mutex> lock(_clientsMutex);
-  if (idx >= static_cast<std::size_t>(_clients.size())) {
+  auto table = getClientTable();
+  if (idx >= table->slots.size()) {
     return nullptr;
   }
-  return _clients[idx];
+  return table->slots[idx];
 }
 
 /**
@@ -787,12 +818,86 @@ std::shared_ptr<server::Client> server::Server::getClient(
  */
 std::shared_ptr<server::Client> server::Server::getClientById(
     int player_id) const {
-  for (const auto &client : _clients) {
-    if (client && client->_player_id == player_id) {
-      return client;
-    }
-  }
-  return nullptr;
+  return getClientTable()->findById(player_id);
+}
+
+/**
+ * @brief Resolve a player identifier to its client slot in constant time.
+ *
+ * Player IDs are assigned so that no two live clients share the same
+ * `id % max_clients`, which makes that value an index into the ID to slot
+ * array (see Server::assignPlayerId()).
+ *
+ * @param player_id The player identifier to look up.
+ * @return std::size_t Slot of the client, or NO_CLIENT_SLOT if no client
+ * with that ID is registered.
+ */
+std::size_t server::ClientTable::findSlot(int player_id) const {
+  if (player_id < 0 || slot_by_id.empty())
+    return NO_CLIENT_SLOT;
+  const std::size_t slot =
+      slot_by_id[static_cast<std::size_t>(player_id) % slot_by_id.size()];
+  if (slot == NO_CLIENT_SLOT || !slots[slot] ||
+      slots[slot]->_player_id != player_id)
+    return NO_CLIENT_SLOT;
+  return slot;
+}
+
+std::shared_ptr<server::Client> server::ClientTable::findById(
+    int player_id) const {
+  const std::size_t slot = findSlot(player_id);
+  return slot == NO_CLIENT_SLOT ? nullptr : slots[slot];
+}
+
+/**
+ * @brief Pick the next player ID and bind it to a client slot.
+ *
+ * IDs keep increasing, but one whose `id % max_clients` entry is still held
+ * by a live client is skipped, so the ID to slot array never collides. At
+ * most max_clients - 1 entries are held when a slot is free, so the search
+ * always ends. Must be called with `_clientsMutex` held.
+ *
+ * @param table Table being built for publication.
+ * @param slot Client slot the new ID refers to.
+ * @return int The assigned player ID.
+ */
+int server::Server::assignPlayerId(ClientTable &table, std::size_t slot) {
+  const std::size_t capacity = table.slot_by_id.size();
+  while (table.slot_by_id[static_cast<std::size_t>(_next_player_id) %
+                          capacity] != NO_CLIENT_SLOT)
+    ++_next_player_id;
+  const int id = _next_player_id++;
+  table.slot_by_id[static_cast<std::size_t>(id) % capacity] = slot;
+  return id;
+}
+
+/**
+ * @brief Remove a client from the client table: publish a copy without its
+ * slot, endpoint and ID entries, put the slot back on the free-slot stack
+ * and drop its network route.
+ *
+ * Takes the client table writer lock. Handlers still holding the client keep
+ * a valid object; it is destroyed with the last reference.
+ *
+ * @param client Client to remove; ignored if no longer in the table.
+ */
+void server::Server::releaseClientSlot(const std::shared_ptr<Client> &client) {
+  std::lock_guard<std::mutex> lock(_clientsMutex);
+  auto current = _clientTable.load(std::memory_order_acquire);
+  const std::size_t slot = current->findSlot(client->_player_id);
+  if (slot == NO_CLIENT_SLOT || current->slots[slot] != client)
+    return;
+
+  auto table = std::make_shared<ClientTable>(*current);
+  auto it = table->slot_by_endpoint.find(client->_route.endpoint);
+  if (it != table->slot_by_endpoint.end() && it->second == slot)
+    table->slot_by_endpoint.erase(it);
+  table->slot_by_id[static_cast<std::size_t>(client->_player_id) %
+                    table->slot_by_id.size()] = NO_CLIENT_SLOT;
+  table->slots[slot].reset();
+  _clientTable.store(std::move(table), std::memory_order_release);
+  _freeClientSlots.push_back(slot);
+  _networkManager.unregisterClient(client->_player_id);
 }
 
 /**
@@ -800,38 +905,41 @@ std::shared_ptr<server::Client> server::Server::getClientById(
  * them from their room if assigned.
  *
  * Instructs the game manager to have the client leave their room when the
- * client's _room_id is not NO_ROOM, then resets the stored client pointer to
- * free the slot.
+ * client's _room_id is not NO_ROOM, under the client's own lock, then removes
+ * the client from the client table to free the slot.
  *
  * @param player_id Identifier of the player whose client slot should be
  * cleared.
  */
 void server::Server::clearClientSlot(int player_id) {
-  std::lock_guard<std::shared_mutex> lock(_clientsMutex);
-  for (auto &client : _clients) {
-    if (client && client->_player_id == player_id) {
-      if (client->_room_id != NO_ROOM) {
-        _gameManager->leaveRoom(client);
-      }
-      client->_connected = false;
-      client.reset();
-      return;
+  auto client = getClientById(player_id);
+  if (!client)
+    return;
+  {
+    std::lock_guard<std::mutex> lock(client->_stateMutex);
+    if (client->_room_id != NO_ROOM) {
+      _gameManager->leaveRoom(client);
     }
+    client->_connected = false;
   }
+  releaseClientSlot(client);
 }
 
 /**
  * @brief Retransmits any unacknowledged packets for all currently connected
  * clients.
  *
- * Iterates connected client slots and requests each client to resend its queued
- * unacknowledged packets using the server's network manager.
+ * Runs every RESEND_WHEEL_TICK_MS. Iterates a snapshot of the client table
+ * and has each connected client resend the unacknowledged packets whose
+ * retransmission timeout expired, then sends an ack-only datagram to the
+ * clients owed an acknowledgement for ACK_FLUSH_DELAY_MS.
  */
 void server::Server::handleUnacknowledgedPackets() {
-  std::lock_guard<std::shared_mutex> lock(_clientsMutex);
-  for (auto &client : _clients) {
+  auto table = getClientTable();
+  for (const auto &client : table->slots) {
     if (client && client->_connected) {
       client->resendUnacknowledgedPackets(_networkManager);
+      _networkManager.flushAcks(client->_route);
     }
   }
 }
@@ -881,27 +989,54 @@ void server::Server::processPendingClientRemovals() {
  * @brief Processes queued game events for each active room and prunes empty
  * rooms.
  *
- * Polls each active room's game event queue, dispatches every popped event to
- * the server's event handler, and ensures pending client removals are processed
- * before event dispatch. After processing all rooms, removes any empty rooms
- * from the game manager.
+ * Ensures pending client removals are processed before event dispatch, then
+ * has every active room's events dispatched on the network thread the room is
+ * pinned to (see processRoomEvents()). After processing all rooms, removes any
+ * empty rooms from the game manager.
  */
 void server::Server::processGameEvents() {
   auto rooms = _gameManager->getAllRooms();
+  const std::size_t currentShard = _networkManager.getCurrentShard();
 
   for (auto &room : rooms) {
     if (!room || !room->isActive()) {
       continue;
     }
 
-    queue::GameEvent event;
-
     processPendingClientRemovals();
 
-    while (room->getGame().getEventQueue().popRequest(event)) {
-      handleGameEvent(event, room->getRoomId());
+    if (room->getShard() == currentShard) {
+      processRoomEvents(room);
+    } else {
+      _networkManager.post(room->getShard(),
+                           [this, room]() { processRoomEvents(room); });
     }
   }
 
   _gameManager->removeEmptyRooms();
 }
+
+/**
+ * @brief Dispatch every queued game event of a room to the server's event
+ * handler.
+ *
+ * Runs on the room's network thread, where most of its clients' sockets are
+ * served, so the broadcasts it produces are sent without crossing threads.
+ * The room's client list is snapshotted once for the whole drain instead of
+ * being looked up and copied for every event. The state updates collected by
+ * the drain are then flushed through the room's replication scheduler.
+ *
+ * @param room Room whose event queue is drained.
+ */
+void server::Server::processRoomEvents(
+    const std::shared_ptr<game::GameRoom> &room) {
+  if (!room->isActive())
+    return;
+
+  auto clients = room->getClientsSnapshot();
+  queue::GameEvent event;
+  while (room->getGame().getEventQueue().popRequest(event)) {
+    handleGameEvent(event, room, *clients);
+  }
+  room->getReplicationScheduler().flush(_networkManager, *clients);
+}
@@ -1,18 +1,21 @@
 #pragma once
 
 #include <asio.hpp>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <queue>
 #include <shared_mutex>
+#include <string>
 #include <unordered_map>
 #include <vector>
 #include "Client.hpp"
 #include "DatabaseManager.hpp"
 #include "Events.hpp"
 #include "GameManager.hpp"
-#include "PacketFactory.hpp"
+#include "PacketDispatcher.hpp"
+#include "Serializer.hpp"
 #include "ServerNetworkManager.hpp"
 #include "game/Challenge.hpp"
 #include "game/GameManager.hpp"
@@ -24,10 +27,35 @@ namespace game {
 
 namespace server {
 
+  /**
+   * @brief Immutable view of the connected clients and their lookup
+   * indexes: slot array, endpoint to slot hash and ID to slot array.
+   *
+   * Readers (every received datagram, handlers, timers) load the current
+   * table without locking and keep it alive through its shared_ptr;
+   * connections and disconnections copy it, apply their change and publish
+   * the copy. A client released meanwhile stays valid for whoever still
+   * holds it.
+   */
+  struct ClientTable {
+      std::vector<std::shared_ptr<Client>> slots;
+      std::unordered_map<asio::ip::udp::endpoint, std::size_t,
+                         network::EndpointHash>
+          slot_by_endpoint;
+      std::vector<std::size_t> slot_by_id;
+
+      std::size_t findSlot(int player_id) const;
+      std::shared_ptr<Client> findById(int player_id) const;
+  };
+
   class Server {
     public:
-      Server(std::uint16_t port, std::uint8_t max_clients,
-             std::uint8_t max_clients_per_room);
+      Server(std::uint16_t port, std::uint16_t max_clients,
+             std::uint8_t max_clients_per_room,
+             const std::string &record_directory = "",
+             std::size_t network_threads = 1,
+             std::size_t aggregation_mtu = AGGREGATION_MTU,
+             std::size_t client_send_rate = CLIENT_SEND_RATE);
       /**
        * @brief Stops the server and releases networking and game resources.
        *
@@ -65,8 +93,20 @@ namespace server {
         _player_count = player_count;
       }
 
-      const std::vector<std::shared_ptr<Client>> &getClients() const {
-        return _clients;
+      /**
+       * @brief Atomically decrement the number of connected players, as
+       * handlers for different clients may run concurrently.
+       */
+      void decrementPlayerCount() {
+        --_player_count;
+      }
+
+      /**
+       * @brief Current snapshot of the client table; safe to use without
+       * locking from any thread.
+       */
+      std::shared_ptr<const ClientTable> getClientTable() const {
+        return _clientTable.load(std::memory_order_acquire);
       }
 
       game::GameManager &getGameManager() {
@@ -143,15 +183,25 @@ namespace server {
     private:
       void startReceive();
       void handleReceive(const char *data, std::size_t bytes_transferred);
+      void handlePacket(const std::shared_ptr<Client> &client,
+                        const network::AckHeader &ackHeader,
+                        serialization::ByteView packet);
 
       void handleTimeout();
 
       void processGameEvents();
-      void handleGameEvent(const queue::GameEvent &event, std::uint32_t roomId);
-
-      size_t findExistingClient();
-      void handlePlayerInfoPacket(const char *data, std::size_t size);
-      void handleClientData(std::size_t client_idx, const char *data,
+      void processRoomEvents(const std::shared_ptr<game::GameRoom> &room);
+      void handleGameEvent(const queue::GameEvent &event,
+                           const std::shared_ptr<game::GameRoom> &room,
+                           const std::vector<std::shared_ptr<Client>> &clients);
+
+      std::shared_ptr<Client> findExistingClient();
+      int assignPlayerId(ClientTable &table, std::size_t slot);
+      void releaseClientSlot(const std::shared_ptr<Client> &client);
+      void handlePlayerInfoPacket(const network::AckHeader &ackHeader,
+                                  const char *data, std::size_t size);
+      void handleClientData(const std::shared_ptr<Client> &client,
+                            const PacketHeader &header, const char *data,
                             std::size_t size);
 
       std::shared_ptr<Client> getClient(std::size_t idx) const;
@@ -166,8 +216,9 @@ namespace server {
 
       network::ServerNetworkManager _networkManager;
 
-      std::vector<std::shared_ptr<Client>> _clients;
-      packet::PacketHandlerFactory _factory;
+      std::atomic<std::shared_ptr<const ClientTable>> _clientTable;
+      std::vector<std::size_t> _freeClientSlots;
+      packet::PacketDispatcher _dispatcher;
 
       std::uint16_t screen_width = 800;
       std::uint16_t screen_height = 1200;
@@ -176,7 +227,7 @@ namespace server {
       game::Challenge _challenge;
       std::shared_ptr<database::DatabaseManager> _databaseManager;
 
-      mutable std::shared_mutex _clientsMutex;
+      std::mutex _clientsMutex;  // serializes client table writers
 
       mutable std::mutex _lastProcessedSeqMutex;
       std::unordered_map<uint32_t, uint64_t> _lastProcessedSeq;
@@ -184,10 +235,10 @@ namespace server {
       mutable std::mutex _clientsToRemoveMutex;
       std::queue<std::uint32_t> _clientsToRemove;
 
-      std::uint8_t _max_clients;
+      std::uint16_t _max_clients;
       std::uint8_t _max_clients_per_room = 4;
       std::uint16_t _port;
-      int _player_count;
+      std::atomic<int> _player_count;
       int _next_player_id;
       std::uint32_t _projectile_count;
 
@@ -1,7 +1,6 @@
 #include "Game.hpp"
 #include <chrono>
 #include <cstdint>
-#include <cstdlib>
 #include <iostream>
 #include <mutex>
 #include <thread>
@@ -15,6 +14,7 @@
 #include "Packet.hpp"
 #include "PlayerComponent.hpp"
 #include "PositionComponent.hpp"
+#include "PositionHistoryComponent.hpp"
 #include "ProjectileComponent.hpp"
 #include "ProjectileSystem.hpp"
 #include "ScoreComponent.hpp"
@@ -23,10 +23,19 @@
 #include "SpeedComponent.hpp"
 #include "VelocityComponent.hpp"
 
-game::Game::Game()
-    : _running(false), _ecsManager(std::make_unique<ecs::ECSManager>()) {
+/**
+ * @brief Create a game whose random spawns are driven by an engine seeded
+ * with `seed`, so that a recorded match can be replayed identically.
+ *
+ * @param seed Seed of the game's random engine.
+ */
+game::Game::Game(std::uint32_t seed)
+    : _running(false),
+      _seed(seed),
+      _rng(seed),
+      _ecsManager(std::make_unique<ecs::ECSManager>()) {
   initECS();
-  srand(time(nullptr));
+  prewarmPools();
 }
 
 /**
@@ -54,6 +63,7 @@ game::Game::~Game() {
   }
 
   clearAllEntities();
+  _recorder.reset();
 
   _enemySystem.reset();
   _collisionSystem.reset();
@@ -72,7 +82,8 @@ game::Game::~Game() {
  *
  * Registered components: PositionComponent, HealthComponent, SpeedComponent,
  * PlayerComponent, ProjectileComponent, VelocityComponent, EnemyComponent,
- * ShootComponent, ColliderComponent, ScoreComponent.
+ * ShootComponent, ColliderComponent, ScoreComponent,
+ * PositionHistoryComponent.
  */
 void game::Game::initECS() {
   try {
@@ -86,6 +97,7 @@ void game::Game::initECS() {
     _ecsManager->registerComponent<ecs::ShootComponent>();
     _ecsManager->registerComponent<ecs::ColliderComponent>();
     _ecsManager->registerComponent<ecs::ScoreComponent>();
+    _ecsManager->registerComponent<ecs::PositionHistoryComponent>();
   } catch (const std::runtime_error &e) {
     std::cerr << "ECS Component registration error: " << e.what() << std::endl;
     return;
@@ -181,9 +193,7 @@ void game::Game::stop() {
  * enemies.
  *
  * Enqueues a GameStartEvent immediately, then repeatedly:
- * - calculates and stores frame delta time in `_deltaTime`,
- * - updates the enemy, projectile, and collision systems with the delta time,
- * - runs enemy spawn logic,
+ * - calculates the frame delta time and simulates one tick(),
  * - dynamically sleeps to maintain a consistent tick rate.
  *
  * The loop ends when `_running` becomes false or if any required system
@@ -221,14 +231,8 @@ void game::Game::gameLoop() {
     }
 
     std::chrono::duration<float> deltaTime = frameStart - lastTime;
-    _deltaTime.store(deltaTime.count());
     lastTime = frameStart;
-
-    _serverInputSystem->update(deltaTime.count());
-    _enemySystem->update(deltaTime.count());
-    _projectileSystem->update(deltaTime.count());
-    _collisionSystem->update(deltaTime.count());
-    spawnEnemy(deltaTime.count());
+    tick(deltaTime.count());
 
     auto frameEnd = std::chrono::high_resolution_clock::now();
     auto frameDuration = frameEnd - frameStart;
@@ -238,29 +242,88 @@ void game::Game::gameLoop() {
   }
 }
 
+/**
+ * @brief Simulate a single game tick.
+ *
+ * Stores the delta time in `_deltaTime`, updates the input, enemy,
+ * projectile, and collision systems, runs enemy spawn logic, records the
+ * position history of players and enemies, closes the tick in the recording
+ * if one is active, and advances the tick counter. Called by the game loop,
+ * or directly by the replay tool to run a recorded match headless.
+ *
+ * @param deltaTime Time elapsed since the previous tick in seconds.
+ */
+void game::Game::tick(float deltaTime) {
+  _deltaTime.store(deltaTime);
+
+  _serverInputSystem->update(deltaTime);
+  _enemySystem->update(deltaTime);
+  _projectileSystem->update(deltaTime);
+  _collisionSystem->update(deltaTime);
+  spawnEnemy(deltaTime);
+  recordPositionHistory();
+
+  if (_recorder)
+    _recorder->recordTick(deltaTime);
+  _currentTick.fetch_add(1, std::memory_order_release);
+}
+
+/**
+ * @brief Start recording the match to a binary log for headless replay.
+ *
+ * Writes the seed, then records every input applied by the
+ * ServerInputSystem. Joins, leaves and shots are recorded by the network
+ * handlers through getRecorder().
+ *
+ * @param path Path of the log file to create.
+ * @return true if recording started, false if the file could not be opened.
+ */
+bool game::Game::startRecording(const std::string &path) {
+  auto recorder = std::make_unique<RoomRecorder>();
+  if (!recorder->open(path, _seed))
+    return false;
+  _recorder = std::move(recorder);
+
+  if (_serverInputSystem) {
+    _serverInputSystem->setInputObserver(
+        [this](Entity entity, const ecs::PlayerInput &input) {
+          if (!_recorder ||
+              !_ecsManager->hasComponent<ecs::PlayerComponent>(entity))
+            return;
+          _recorder->recordInput(
+              _ecsManager->getComponent<ecs::PlayerComponent>(entity)
+                  .player_id,
+              static_cast<std::uint8_t>(input.input), input.tick);
+        });
+  }
+  return true;
+}
+
 /**
  * @brief Create a new player entity, attach initial components, and register
  * the player.
  *
  * Creates an ECS entity for the player, attaches Position, Health, Speed,
- * Player, Velocity, Shoot, Collider, and Score components, stores the
- * resulting Player instance in the game's player registry, and returns it.
+ * Player, Velocity, Shoot, Collider, and Score components, assigns it an
+ * input slot in the ServerInputSystem, stores the resulting Player instance
+ * in the game's player slot map, and returns a copy of its state.
  *
  * @param player_id Unique identifier for the player.
  * @param name Player display name.
- * @return std::shared_ptr<game::Player> Shared pointer to the created Player
- * stored in the game.
+ * @return std::optional<game::PlayerState> State of the created player.
  */
-std::shared_ptr<game::Player> game::Game::createPlayer(
+std::optional<game::PlayerState> game::Game::createPlayer(
     std::uint32_t player_id, const std::string &name) {
   std::scoped_lock lock(_playerMutex, _ecsMutex);
   auto entity = _ecsManager->createEntity();
+  const ecs::SlotHandle handle =
+      _players.emplace(player_id, entity, *_ecsManager);
 
   _ecsManager->addComponent<ecs::PositionComponent>(entity, {10.0f, 10.0f});
   _ecsManager->addComponent<ecs::HealthComponent>(entity, {100, 100});
   _ecsManager->addComponent<ecs::SpeedComponent>(entity, {PLAYER_SPEED});
   _ecsManager->addComponent<ecs::PlayerComponent>(
-      entity, {player_id, name, true, 0, true});
+      entity, {player_id, name, true, 0, true, handle});
   _ecsManager->addComponent<ecs::VelocityComponent>(entity, {0.0f, 0.0f});
   _ecsManager->addComponent<ecs::ShootComponent>(entity,
                                                  {0.0f, 3.0f, true, 0.0f});
@@ -269,46 +332,132 @@ std::shared_ptr<game::Player> game::Game::createPlayer(
   collider.halfSize = {25.f, 25.f};
   _ecsManager->addComponent<ecs::ColliderComponent>(entity, collider);
   _ecsManager->addComponent<ecs::ScoreComponent>(entity, {0});
+  ecs::PositionHistoryComponent history;
+  history.record(getCurrentTick(), 10.0f, 10.0f);
+  _ecsManager->addComponent<ecs::PositionHistoryComponent>(entity, history);
 
-  auto player = std::make_shared<Player>(player_id, entity, *_ecsManager);
-  _players[player_id] = player;
+  if (_serverInputSystem)
+    _serverInputSystem->registerPlayer(entity);
 
-  return player;
+  _playerHandles[static_cast<int>(player_id)] = handle;
+  return makePlayerState(*_players.get(handle));
 }
 
 /**
  * @brief Removes a player and its associated ECS entity from the game.
  *
- * Destroys the ECS entity owned by the player with the given id and removes
- * the player from the internal registry. If no player with that id exists,
- * the function has no effect.
+ * Destroys the ECS entity owned by the player with the given id and frees
+ * the player's slot. If no player with that id exists, the function has no
+ * effect.
  *
  * @param player_id Identifier of the player to remove.
  */
 void game::Game::destroyPlayer(int player_id) {
   std::lock_guard<std::mutex> lock(_playerMutex);
-  auto it = _players.find(player_id);
-  if (it != _players.end()) {
-    std::uint32_t entity_id = it->second->getEntityId();
+  auto it = _playerHandles.find(player_id);
+  if (it == _playerHandles.end())
+    return;
+  if (Player *player = _players.get(it->second)) {
+    std::uint32_t entity_id = player->getEntityId();
+    if (_serverInputSystem)
+      _serverInputSystem->removeEntity(entity_id);
     _ecsManager->destroyEntity(entity_id);
-    _players.erase(it);
+    _players.erase(it->second);
   }
+  _playerHandles.erase(it);
+}
+
+/**
+ * @brief Copy the state of a player while the player lock is held.
+ *
+ * Callers must hold `_playerMutex`.
+ */
+game::PlayerState game::Game::makePlayerState(const Player &player) const {
+  PlayerState state;
+  state.player_id = player.getPlayerId();
+  state.entity_id = player.getEntityId();
+  state.name = player.getName();
+  state.position = player.getPosition();
+  state.speed = player.getSpeed();
+  state.max_health = player.getMaxHealth().value_or(100);
+  state.connected = player.isConnected();
+  return state;
+}
+
+/**
+ * @brief Retrieve a copy of the state of a player.
+ *
+ * The player may be destroyed by another thread as soon as the lock is
+ * released, so its state is copied rather than handed out by pointer.
+ *
+ * @param player_id Identifier of the player.
+ * @return std::optional<game::PlayerState> The player's state, or
+ * `std::nullopt` if no such player exists.
+ */
+std::optional<game::PlayerState> game::Game::getPlayerState(
+    int player_id) const {
+  std::lock_guard<std::mutex> lock(_playerMutex);
+  auto it = _playerHandles.find(player_id);
+  if (it == _playerHandles.end())
+    return std::nullopt;
+  const Player *player = _players.get(it->second);
+  if (!player)
+    return std::nullopt;
+  return makePlayerState(*player);
 }
 
-std::shared_ptr<game::Player> game::Game::getPlayer(int player_id) {
+/**
+ * @brief Fill `states` with a copy of the state of every player.
+ *
+ * The vector is cleared first and its storage reused.
+ *
+ * @param states Receives one PlayerState per player.
+ */
+void game::Game::getPlayerStates(std::vector<PlayerState> &states) const {
   std::lock_guard<std::mutex> lock(_playerMutex);
-  auto it = _players.find(player_id);
-  return (it != _players.end()) ? it->second : nullptr;
+  states.clear();
+  _players.forEach([this, &states](ecs::SlotHandle, const Player &player) {
+    states.push_back(makePlayerState(player));
+  });
 }
 
-std::vector<std::shared_ptr<game::Player>> game::Game::getAllPlayers() const {
+/**
+ * @brief Resolve a player handle into a copy of the player's facade.
+ *
+ * The facade only holds the player's ids, so the copy stays safe to use
+ * after another thread destroys the player; its accessors then find no
+ * components.
+ *
+ * @param handle Handle kept in the player's PlayerComponent.
+ * @return std::optional<game::Player> The facade, or `std::nullopt` if the
+ * handle is stale.
+ */
+std::optional<game::Player> game::Game::getPlayer(
+    ecs::SlotHandle handle) const {
   std::lock_guard<std::mutex> lock(_playerMutex);
-  std::vector<std::shared_ptr<Player>> playerList;
-  playerList.reserve(_players.size());
-  for (const auto &pair : _players) {
-    playerList.push_back(pair.second);
-  }
-  return playerList;
+  const Player *player = _players.get(handle);
+  if (!player)
+    return std::nullopt;
+  return *player;
+}
+
+/**
+ * @brief Fill `positions` with the position of every player.
+ *
+ * The vector is cleared first and its storage reused, so calling this once
+ * per tick does not allocate once it has grown to the room's size.
+ *
+ * @param positions Receives one (x, y) pair per player.
+ */
+void game::Game::getPlayerPositions(
+    std::vector<std::pair<float, float>> &positions) const {
+  std::lock_guard<std::mutex> lock(_playerMutex);
+  positions.clear();
+  _players.forEach([this, &positions](ecs::SlotHandle, const Player &player) {
+    const auto &pos = _ecsManager->getComponent<ecs::PositionComponent>(
+        player.getEntityId());
+    positions.emplace_back(pos.x, pos.y);
+  });
 }
 
 /**
@@ -354,102 +503,93 @@ void game::Game::spawnEnemy(float deltaTime) {
 /**
  * @brief Create and register an enemy with the specified id and type.
  *
- * Creates an enemy entity, configures its gameplay components according to
- * the given EnemyType, stores the resulting Enemy instance in the game's
- * enemy registry, and returns a shared pointer to that Enemy.
+ * Takes a pooled enemy entity (creating one only when the pool is empty),
+ * resets its gameplay components according to the given EnemyType, stores
+ * the Enemy facade in the game's enemy slot map, and returns it.
  *
  * @param enemy_id Unique identifier assigned to the new enemy.
  * @param type EnemyType value that determines the enemy's configuration and
- * behavior.
- * @return std::shared_ptr<Enemy> Shared pointer to the created Enemy, or
- * `nullptr` if the provided EnemyType is unsupported.
+ * components.
+ * @return game::Enemy* The created Enemy, or `nullptr` if the type is not
+ * supported.
  */
-std::shared_ptr<game::Enemy> game::Game::createEnemy(int enemy_id,
-                                                     const EnemyType type) {
+game::Enemy *game::Game::createEnemy(int enemy_id, const EnemyType type) {
   std::lock_guard<std::mutex> lock(_enemyMutex);
-  std::uint32_t entity;
   switch (type) {
     case EnemyType::BASIC_FIGHTER: {
       std::lock_guard<std::mutex> lock(_ecsMutex);
-      entity = _ecsManager->createEntity();
+      const std::uint32_t entity = acquireEnemyEntity();
+      const ecs::SlotHandle handle =
+          _enemies.emplace(enemy_id, entity, *_ecsManager);
 
+      std::uniform_int_distribution<int> spawnDistribution(0,
+                                                           ENEMY_SPAWN_Y - 1);
       float spawnY =
-          static_cast<float>(rand() % ENEMY_SPAWN_Y + ENEMY_SPAWN_OFFSET);
+          static_cast<float>(spawnDistribution(_rng) + ENEMY_SPAWN_OFFSET);
       float spawnX = ENEMY_SPAWN_X;
 
-      _ecsManager->addComponent<ecs::EnemyComponent>(entity, {enemy_id, type});
-      _ecsManager->addComponent<ecs::PositionComponent>(entity,
-                                                        {spawnX, spawnY});
-      _ecsManager->addComponent<ecs::HealthComponent>(entity, {100, 100});
-      _ecsManager->addComponent<ecs::VelocityComponent>(entity,
-                                                        {ENEMY_SPEED, 0.0f});
-      _ecsManager->addComponent<ecs::ShootComponent>(entity,
-                                                     {0.0f, 3.0f, true, 0.0f});
+      _ecsManager->getComponent<ecs::EnemyComponent>(entity) = {
+          enemy_id, type, true, handle};
+      _ecsManager->getComponent<ecs::PositionComponent>(entity) = {spawnX,
+                                                                   spawnY};
+      _ecsManager->getComponent<ecs::HealthComponent>(entity) = {100, 100};
+      _ecsManager->getComponent<ecs::VelocityComponent>(entity) = {ENEMY_SPEED,
+                                                                   0.0f};
+      _ecsManager->getComponent<ecs::ShootComponent>(entity) = {0.0f, 3.0f,
+                                                                true, 0.0f};
       ecs::ColliderComponent collider;
       collider.center = {25.f, 25.f};
       collider.halfSize = {25.f, 30.f};
-      _ecsManager->addComponent<ecs::ColliderComponent>(entity, collider);
-      _ecsManager->addComponent<ecs::ScoreComponent>(entity, {10});
-      break;
+      _ecsManager->getComponent<ecs::ColliderComponent>(entity) = collider;
+      _ecsManager->getComponent<ecs::ScoreComponent>(entity) = {10};
+      ecs::PositionHistoryComponent history;
+      history.record(getCurrentTick(), spawnX, spawnY);
+      _ecsManager->getComponent<ecs::PositionHistoryComponent>(entity) =
+          history;
+      return _enemies.get(handle);
     }
     default:
       return nullptr;
   }
-
-  auto enemy = std::make_shared<Enemy>(enemy_id, entity, *_ecsManager);
-  _enemies[enemy_id] = enemy;
-  return enemy;
 }
 
 /**
- * @brief Removes the enemy with the given id, marks it as dead, and destroys
- * its ECS entity.
+ * @brief Removes the enemy referenced by `handle`, marks it as dead, and
+ * returns its entity to the enemy pool.
  *
- * If the enemy exists, its EnemyComponent (if present) will have `is_alive`
- * set to `false`, the corresponding ECS entity will be destroyed, and the
- * enemy will be removed from the registry. The operation is guarded by the
- * internal enemy mutex.
+ * The enemy's EnemyComponent gets `is_alive` set to `false`, which makes
+ * every system skip it, its slot is freed and its ECS entity is kept, with
+ * all components attached, for the next spawn. The operation is guarded by
+ * the internal enemy mutex.
  *
- * @param enemy_id Identifier of the enemy to destroy. No action is taken if
- * no enemy with this id exists.
+ * @param handle Handle of the enemy to destroy. No action is taken if it is
+ * stale.
  */
-void game::Game::destroyEnemy(int enemy_id) {
+void game::Game::destroyEnemy(ecs::SlotHandle handle) {
   std::lock_guard<std::mutex> lock(_enemyMutex);
-  auto it = _enemies.find(enemy_id);
-  if (it != _enemies.end()) {
-    auto enemy = it->second;
-    std::uint32_t entity_id = enemy->getEntityId();
-
-    if (_ecsManager->hasComponent<ecs::EnemyComponent>(entity_id)) {
-      auto &enemyComp =
-          _ecsManager->getComponent<ecs::EnemyComponent>(entity_id);
-      enemyComp.is_alive = false;
-    }
+  Enemy *enemy = _enemies.get(handle);
+  if (!enemy)
+    return;
+  std::uint32_t entity_id = enemy->getEntityId();
 
-    _ecsManager->destroyEntity(entity_id);
-    _enemies.erase(it);
+  if (_ecsManager->hasComponent<ecs::EnemyComponent>(entity_id)) {
+    auto &enemyComp = _ecsManager->getComponent<ecs::EnemyComponent>(entity_id);
+    enemyComp.is_alive = false;
   }
-}
 
-std::shared_ptr<game::Enemy> game::Game::getEnemy(int enemy_id) {
-  std::lock_guard<std::mutex> lock(_enemyMutex);
-  auto it = _enemies.find(enemy_id);
-  return (it != _enemies.end()) ? it->second : nullptr;
+  _enemies.erase(handle);
+  _enemyEntityPool.push_back(entity_id);
 }
 
-std::vector<std::shared_ptr<game::Enemy>> game::Game::getAllEnemies() const {
+game::Enemy *game::Game::getEnemy(ecs::SlotHandle handle) {
   std::lock_guard<std::mutex> lock(_enemyMutex);
-  std::vector<std::shared_ptr<Enemy>> enemyList;
-  enemyList.reserve(_enemies.size());
-  for (const auto &pair : _enemies) {
-    enemyList.push_back(pair.second);
-  }
-  return enemyList;
+  return _enemies.get(handle);
 }
 
 /**
- * @brief Create a new projectile entity, register it with the ECS and game
- * registry, and emit a ProjectileSpawnEvent.
+ * @brief Activate a pooled projectile entity (creating one only when the
+ * pool is empty), register it in the game's projectile slot map, and emit a
+ * ProjectileSpawnEvent.
  *
  * @param projectile_id Unique identifier for the projectile.
  * @param owner_id Identifier of the entity that fired the projectile.
@@ -458,33 +598,32 @@ std::vector<std::shared_ptr<game::Enemy>> game::Game::getAllEnemies() const {
  * @param y Initial Y position.
  * @param vx Initial X velocity.
  * @param vy Initial Y velocity.
- * @return std::shared_ptr<game::Projectile> Shared pointer to the created
- * projectile.
+ * @param rewind_ticks Number of ticks enemies are rewound by when checking
+ * this projectile for hits (lag compensation for the shooter).
+ * @return game::Projectile* The created projectile.
  */
-std::shared_ptr<game::Projectile> game::Game::createProjectile(
+game::Projectile *game::Game::createProjectile(
     std::uint32_t projectile_id, std::uint32_t owner_id, ProjectileType type,
-    float x, float y, float vx, float vy) {
-  std::shared_ptr<Projectile> projectile;
-  std::uint32_t entity;
+    float x, float y, float vx, float vy, std::uint32_t rewind_ticks) {
+  Projectile *projectile;
   {
-    std::lock_guard<std::mutex> lock(_ecsMutex);
-    entity = _ecsManager->createEntity();
-    _ecsManager->addComponent<ecs::PositionComponent>(entity, {x, y});
-    _ecsManager->addComponent<ecs::SpeedComponent>(entity, {10.0f});
-    _ecsManager->addComponent<ecs::ProjectileComponent>(
-        entity, {projectile_id, type, owner_id, false,
-                 (type == ProjectileType::ENEMY_BASIC), 10, 0, 100});
-    _ecsManager->addComponent<ecs::VelocityComponent>(entity, {vx, vy});
+    std::scoped_lock lock(_projectileMutex, _ecsMutex);
+    const std::uint32_t entity = acquireProjectileEntity();
+    const ecs::SlotHandle handle =
+        _projectiles.emplace(projectile_id, owner_id, entity, *_ecsManager);
+
+    _ecsManager->getComponent<ecs::PositionComponent>(entity) = {x, y};
+    _ecsManager->getComponent<ecs::SpeedComponent>(entity) = {10.0f};
+    _ecsManager->getComponent<ecs::ProjectileComponent>(entity) = {
+        projectile_id, type, owner_id, false,
+        (type == ProjectileType::ENEMY_BASIC), 10, 0, 100, rewind_ticks,
+        handle};
+    _ecsManager->getComponent<ecs::VelocityComponent>(entity) = {vx, vy};
     ecs::ColliderComponent collider;
     collider.center = {10.f, 10.f};
     collider.halfSize = {10.f, 10.f};
-    _ecsManager->addComponent<ecs::ColliderComponent>(entity, collider);
-    projectile = std::make_shared<Projectile>(projectile_id, owner_id, entity,
-                                              *_ecsManager);
-  }
-  {
-    std::lock_guard<std::mutex> lock(_projectileMutex);
-    _projectiles[projectile_id] = projectile;
+    _ecsManager->getComponent<ecs::ColliderComponent>(entity) = collider;
+    projectile = _projectiles.get(handle);
   }
 
   queue::ProjectileSpawnEvent event;
@@ -502,88 +641,217 @@ std::shared_ptr<game::Projectile> game::Game::createProjectile(
 }
 
 /**
- * @brief Removes the projectile with the given id from the game and its ECS.
+ * @brief Removes the projectile referenced by `handle` from the game and
+ * returns its entity to the projectile pool.
  *
- * Destroys the projectile's underlying ECS entity and removes the projectile
- * from the internal registry. If no projectile with the given id exists, the
- * call has no effect.
+ * Flags the projectile's ECS entity as destroyed, which makes every system
+ * skip it, frees its slot and keeps the entity, with all components
+ * attached, for the next shot. If the handle is stale, the call has no
+ * effect.
  *
- * @param projectile_id Identifier of the projectile to remove.
+ * @param handle Handle of the projectile to remove.
  */
-void game::Game::destroyProjectile(std::uint32_t projectile_id) {
+void game::Game::destroyProjectile(ecs::SlotHandle handle) {
   std::lock_guard<std::mutex> lock(_projectileMutex);
-  auto it = _projectiles.find(projectile_id);
-  if (it != _projectiles.end()) {
-    auto projectile = it->second;
-    std::uint32_t entity_id = projectile->getEntityId();
-
-    queue::ProjectileDestroyEvent event;
-    event.projectile_id = projectile_id;
-    try {
-      auto pos = projectile->getPosition();
-      event.x = pos.first;
-      event.y = pos.second;
-    } catch (const std::runtime_error &e) {
-      event.x = 0;
-      event.y = 0;
-    }
-    _eventQueue.addRequest(event);
+  Projectile *projectile = _projectiles.get(handle);
+  if (!projectile)
+    return;
+  std::uint32_t entity_id = projectile->getEntityId();
 
-    {
-      std::lock_guard<std::mutex> lock(_ecsMutex);
-      _ecsManager->destroyEntity(entity_id);
-    }
-    _projectiles.erase(it);
+  queue::ProjectileDestroyEvent event;
+  event.projectile_id = projectile->getProjectileId();
+  try {
+    auto pos = projectile->getPosition();
+    event.x = pos.first;
+    event.y = pos.second;
+  } catch (const std::runtime_error &e) {
+    event.x = 0;
+    event.y = 0;
   }
-}
+  _eventQueue.addRequest(event);
 
-std::shared_ptr<game::Projectile> game::Game::getProjectile(
-    std::uint32_t projectile_id) {
-  std::lock_guard<std::mutex> lock(_projectileMutex);
-  auto it = _projectiles.find(projectile_id);
-  return (it != _projectiles.end()) ? it->second : nullptr;
+  {
+    std::lock_guard<std::mutex> lock(_ecsMutex);
+    _ecsManager->getComponent<ecs::ProjectileComponent>(entity_id).is_destroy =
+        true;
+  }
+  _projectiles.erase(handle);
+  _projectileEntityPool.push_back(entity_id);
 }
 
-std::vector<std::shared_ptr<game::Projectile>> game::Game::getAllProjectiles()
-    const {
+game::Projectile *game::Game::getProjectile(ecs::SlotHandle handle) {
   std::lock_guard<std::mutex> lock(_projectileMutex);
-  std::vector<std::shared_ptr<Projectile>> projectileList;
-  projectileList.reserve(_projectiles.size());
-  for (const auto &pair : _projectiles) {
-    projectileList.push_back(pair.second);
-  }
-  return projectileList;
+  return _projectiles.get(handle);
 }
 
 void game::Game::clearAllEntities() {
   std::scoped_lock lk(_playerMutex, _enemyMutex, _projectileMutex, _ecsMutex);
 
-  auto entities = _ecsManager->getAllEntities();
-
-  for (auto entity : entities) {
-    _ecsManager->destroyEntity(entity);
-  }
+  _players.forEach([this](ecs::SlotHandle, const Player &player) {
+    _ecsManager->destroyEntity(player.getEntityId());
+  });
+  _enemies.forEach([this](ecs::SlotHandle, const Enemy &enemy) {
+    _ecsManager->getComponent<ecs::EnemyComponent>(enemy.getEntityId())
+        .is_alive = false;
+    _enemyEntityPool.push_back(enemy.getEntityId());
+  });
+  _projectiles.forEach([this](ecs::SlotHandle, const Projectile &projectile) {
+    _ecsManager->getComponent<ecs::ProjectileComponent>(
+                   projectile.getEntityId())
+        .is_destroy = true;
+    _projectileEntityPool.push_back(projectile.getEntityId());
+  });
 
   _enemies.clear();
   _players.clear();
+  _playerHandles.clear();
   _projectiles.clear();
+  if (_serverInputSystem)
+    _serverInputSystem->clearInputs();
 
   _nextEnemyId = 0;
   _nextProjectileId.store(0, std::memory_order_relaxed);
   _enemySpawnTimer = 0.0f;
 }
 
+/**
+ * @brief Bring a stopped game back to the state of a freshly constructed one
+ * so it can host another match.
+ *
+ * Stops the loop, clears the entities, drops the events the previous match
+ * left undelivered, the recorder and its input observer, rewinds the tick and
+ * sequence counters and reseeds the random engine. Registered components, systems and pooled entities are kept, so
+ * the cost is proportional to the entities that were live, not to the
+ * size of the ECS storage.
+ *
+ * @param seed Seed of the game's random engine for the next match.
+ */
+void game::Game::reset(std::uint32_t seed) {
+  stop();
+  _eventQueue.clear();
+
+  if (_serverInputSystem)
+    _serverInputSystem->setInputObserver(nullptr);
+  _recorder.reset();
+
+  _seed = seed;
+  _rng.seed(seed);
+  _sequence_number.store(0, std::memory_order_relaxed);
+  _currentTick.store(0, std::memory_order_release);
+  _deltaTime.store(0.0f);
+}
+
+/**
+ * @brief Record the current position of every player and enemy in their
+ * position history for the tick being simulated.
+ *
+ * The history is a fixed-size ring buffer stored inline in the component, so
+ * this runs without allocating.
+ */
+void game::Game::recordPositionHistory() {
+  const std::uint32_t tick = getCurrentTick();
+  std::scoped_lock lock(_playerMutex, _enemyMutex);
+
+  auto record = [this, tick](std::uint32_t entity) {
+    if (!_ecsManager->hasComponent<ecs::PositionHistoryComponent>(entity) ||
+        !_ecsManager->hasComponent<ecs::PositionComponent>(entity))
+      return;
+    const auto &pos = _ecsManager->getComponent<ecs::PositionComponent>(entity);
+    _ecsManager->getComponent<ecs::PositionHistoryComponent>(entity).record(
+        tick, pos.x, pos.y);
+  };
+  _players.forEach([&record](ecs::SlotHandle, const Player &player) {
+    record(player.getEntityId());
+  });
+  _enemies.forEach([&record](ecs::SlotHandle, const Enemy &enemy) {
+    record(enemy.getEntityId());
+  });
+}
+
+/**
+ * @brief Pre-create PROJECTILE_POOL_SIZE projectile entities and
+ * ENEMY_POOL_SIZE enemy entities so that the first shots and spawns of a
+ * match do not allocate.
+ */
+void game::Game::prewarmPools() {
+  std::scoped_lock lock(_enemyMutex, _projectileMutex, _ecsMutex);
+  _enemyEntityPool.reserve(ENEMY_POOL_SIZE);
+  _projectileEntityPool.reserve(PROJECTILE_POOL_SIZE);
+  std::vector<std::uint32_t> enemies;
+  std::vector<std::uint32_t> projectiles;
+  while (enemies.size() < ENEMY_POOL_SIZE) {
+    enemies.push_back(acquireEnemyEntity());
+  }
+  while (projectiles.size() < PROJECTILE_POOL_SIZE) {
+    projectiles.push_back(acquireProjectileEntity());
+  }
+  _enemyEntityPool.insert(_enemyEntityPool.end(), enemies.begin(),
+                          enemies.end());
+  _projectileEntityPool.insert(_projectileEntityPool.end(),
+                               projectiles.begin(), projectiles.end());
+}
+
+/**
+ * @brief Take an enemy entity from the pool, or create one carrying every
+ * enemy component, flagged dead until configured.
+ *
+ * Callers must hold `_enemyMutex` and `_ecsMutex`.
+ *
+ * @return std::uint32_t Entity to configure as an enemy.
+ */
+std::uint32_t game::Game::acquireEnemyEntity() {
+  if (!_enemyEntityPool.empty()) {
+    const std::uint32_t entity = _enemyEntityPool.back();
+    _enemyEntityPool.pop_back();
+    return entity;
+  }
+
+  auto entity = _ecsManager->createEntity();
+  _ecsManager->addComponent<ecs::EnemyComponent>(
+      entity, {static_cast<int>(INVALID_ID), EnemyType::BASIC_FIGHTER, false});
+  _ecsManager->addComponent<ecs::PositionComponent>(entity, {});
+  _ecsManager->addComponent<ecs::HealthComponent>(entity, {});
+  _ecsManager->addComponent<ecs::VelocityComponent>(entity, {});
+  _ecsManager->addComponent<ecs::ShootComponent>(entity, {});
+  _ecsManager->addComponent<ecs::ColliderComponent>(entity, {});
+  _ecsManager->addComponent<ecs::ScoreComponent>(entity, {});
+  _ecsManager->addComponent<ecs::PositionHistoryComponent>(entity, {});
+  return entity;
+}
+
+/**
+ * @brief Take a projectile entity from the pool, or create one carrying every
+ * projectile component, flagged destroyed until configured.
+ *
+ * Callers must hold `_projectileMutex` and `_ecsMutex`.
+ *
+ * @return std::uint32_t Entity to configure as a projectile.
+ */
+std::uint32_t game::Game::acquireProjectileEntity() {
+  if (!_projectileEntityPool.empty()) {
+    const std::uint32_t entity = _projectileEntityPool.back();
+    _projectileEntityPool.pop_back();
+    return entity;
+  }
+
+  auto entity = _ecsManager->createEntity();
+  ecs::ProjectileComponent projectile{};
+  projectile.is_destroy = true;
+  _ecsManager->addComponent<ecs::PositionComponent>(entity, {});
+  _ecsManager->addComponent<ecs::SpeedComponent>(entity, {});
+  _ecsManager->addComponent<ecs::ProjectileComponent>(entity, projectile);
+  _ecsManager->addComponent<ecs::VelocityComponent>(entity, {});
+  _ecsManager->addComponent<ecs::ColliderComponent>(entity, {});
+  return entity;
+}
+
 std::unordered_map<int, int> game::Game::getPlayerScores() const {
   std::unordered_map<int, int> scores;
   std::scoped_lock lock(_playerMutex, _ecsMutex);
-  for (const auto &pair : _players) {
-    int playerId = pair.first;
-    auto player = pair.second;
-    if (player) {
-      auto &scoreComp =
-          _ecsManager->getComponent<ecs::ScoreComponent>(player->getEntityId());
-      scores[playerId] = scoreComp.score;
-    }
-  }
+  _players.forEach([this, &scores](ecs::SlotHandle, const Player &player) {
+    auto &scoreComp =
+        _ecsManager->getComponent<ecs::ScoreComponent>(player.getEntityId());
+    scores[player.getPlayerId()] = scoreComp.score;
+  });
   return scores;
 }
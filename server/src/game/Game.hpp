@@ -4,8 +4,12 @@
 #include <cstdint>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <random>
+#include <string>
 #include <thread>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 #include "CollisionSystem.hpp"
 #include "ECSManager.hpp"
@@ -15,39 +19,90 @@
 #include "Projectile.hpp"
 #include "ProjectileSystem.hpp"
 #include "Queue.hpp"
+#include "RoomRecorder.hpp"
 #include "ServerInputSystem.hpp"
+#include "SlotMap.hpp"
 
 namespace game {
 
+  /**
+   * @brief Copy of a player's state, taken under the player lock so that it
+   * stays valid once the player is destroyed.
+   */
+  struct PlayerState {
+      int player_id = 0;
+      std::uint32_t entity_id = 0;
+      std::string name;
+      std::pair<float, float> position{0.0f, 0.0f};
+      float speed = 0.0f;
+      int max_health = 100;
+      bool connected = false;
+  };
+
   class Game {
     public:
-      Game();
+      explicit Game(std::uint32_t seed = std::random_device{}());
       ~Game();
       void start();
       void stop();
+      void tick(float deltaTime);
+      void reset(std::uint32_t seed);
+
+      /**
+       * @brief Retrieve the seed of the game's random engine.
+       *
+       * @return std::uint32_t Seed the game was created with.
+       */
+      std::uint32_t getSeed() const {
+        return _seed;
+      }
+
+      bool startRecording(const std::string &path);
+
+      /**
+       * @brief Retrieve the recorder of this game, if recording is enabled.
+       *
+       * @return RoomRecorder* The active recorder, or `nullptr`.
+       */
+      RoomRecorder *getRecorder() {
+        return _recorder.get();
+      }
 
       /*  Player Management */
-      std::shared_ptr<Player> createPlayer(std::uint32_t player_id,
-                                           const std::string &name);
+      std::optional<PlayerState> createPlayer(std::uint32_t player_id,
+                                              const std::string &name);
 
-      std::shared_ptr<game::Projectile> createProjectile(
-          std::uint32_t projectile_id, std::uint32_t owner_id,
-          ProjectileType type, float x, float y, float vx, float vy);
+      Projectile *createProjectile(std::uint32_t projectile_id,
+                                   std::uint32_t owner_id, ProjectileType type,
+                                   float x, float y, float vx, float vy,
+                                   std::uint32_t rewind_ticks = 0);
       void destroyPlayer(int player_id);
 
-      void destroyProjectile(std::uint32_t projectile_id);
+      void destroyProjectile(ecs::SlotHandle handle);
 
-      std::shared_ptr<Player> getPlayer(int player_id);
+      std::optional<PlayerState> getPlayerState(int player_id) const;
+      void getPlayerStates(std::vector<PlayerState> &states) const;
+      std::optional<Player> getPlayer(ecs::SlotHandle handle) const;
 
-      std::shared_ptr<Projectile> getProjectile(std::uint32_t projectile_id);
+      /**
+       * @brief Resolve a projectile handle. Simulation thread only: it is the
+       * one that destroys projectiles, so the pointer stays valid until it
+       * does.
+       */
+      Projectile *getProjectile(ecs::SlotHandle handle);
 
-      std::vector<std::shared_ptr<Player>> getAllPlayers() const;
+      void getPlayerPositions(
+          std::vector<std::pair<float, float>> &positions) const;
 
       /* Enemy Management */
-      std::shared_ptr<Enemy> createEnemy(int enemy_id, const EnemyType type);
-      void destroyEnemy(int enemy_id);
-      std::shared_ptr<Enemy> getEnemy(int enemy_id);
-      std::vector<std::shared_ptr<Enemy>> getAllEnemies() const;
+      Enemy *createEnemy(int enemy_id, const EnemyType type);
+      void destroyEnemy(ecs::SlotHandle handle);
+
+      /**
+       * @brief Resolve an enemy handle. Simulation thread only, like
+       * getProjectile().
+       */
+      Enemy *getEnemy(ecs::SlotHandle handle);
 
       ecs::ECSManager &getECSManager() {
         return *_ecsManager;
@@ -64,8 +119,6 @@ namespace game {
         return _eventQueue;
       }
 
-      std::vector<std::shared_ptr<Projectile>> getAllProjectiles() const;
-
       std::uint32_t getNextProjectileId() noexcept {
         return _nextProjectileId++;
       }
@@ -73,10 +126,11 @@ namespace game {
       /**
        * @brief Clears all entities from the game, including players, enemies,
        * and projectiles. This method locks the ECS manager to safely destroy
-       * all entities and resets internal state.
+       * player entities, returns enemy and projectile entities to their pools
+       * and resets internal state. Only the live entities are visited.
        *
-       * After calling this method, the game will have no entities and internal
-       * ID counters for enemies and projectiles will be reset.
+       * After calling this method, the game will have no live entities and
+       * internal ID counters for enemies and projectiles will be reset.
        *
        * @note This does not stop the game loop; it only clears entities.
        *
@@ -137,9 +191,20 @@ namespace game {
 
       std::unordered_map<int, int> getPlayerScores() const;
 
+      /**
+       * @brief Retrieve the index of the tick currently being simulated.
+       *
+       * @return std::uint32_t The current server tick.
+       */
+      std::uint32_t getCurrentTick() const {
+        return _currentTick.load(std::memory_order_acquire);
+      }
+
     private:
       void gameLoop();
       void initECS();
+      void recordPositionHistory();
+      PlayerState makePlayerState(const Player &player) const;
       std::atomic<bool> _running;
       std::thread _gameThread;
       std::atomic<float> _deltaTime{0.0f};
@@ -151,12 +216,28 @@ namespace game {
       std::shared_ptr<ecs::CollisionSystem> _collisionSystem;
       std::shared_ptr<ecs::ServerInputSystem> _serverInputSystem;
 
-      std::unordered_map<int, std::shared_ptr<Enemy>> _enemies;
-      std::unordered_map<int, std::shared_ptr<Player>> _players;
-      std::unordered_map<std::uint32_t, std::shared_ptr<Projectile>>
-          _projectiles;
+      void prewarmPools();
+      std::uint32_t acquireEnemyEntity();
+      std::uint32_t acquireProjectileEntity();
+
+      /* Facades are stored inline and addressed by the SlotHandle kept in
+       * their Player/Enemy/ProjectileComponent; only players, looked up by
+       * the network layer, also need an id index. */
+      ecs::SlotMap<Enemy> _enemies;
+      ecs::SlotMap<Player> _players;
+      ecs::SlotMap<Projectile> _projectiles;
+      std::unordered_map<int, ecs::SlotHandle> _playerHandles;
+
+      /* Released enemy/projectile entities, with all components attached,
+       * so that reusing one never allocates. */
+      std::vector<std::uint32_t> _enemyEntityPool;
+      std::vector<std::uint32_t> _projectileEntityPool;
 
       std::atomic<std::uint32_t> _sequence_number{0};
+      std::atomic<std::uint32_t> _currentTick{0};
+      std::uint32_t _seed;
+      std::mt19937 _rng;
+      std::unique_ptr<RoomRecorder> _recorder;
       float _enemySpawnTimer = 0.0f;
       float _enemySpawnInterval = 5.0f;
       int _nextEnemyId = 0;
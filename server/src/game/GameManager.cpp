@@ -1,15 +1,21 @@
 #include "GameManager.hpp"
 #include <atomic>
 #include <cstdint>
+#include <ctime>
 #include <iostream>
 #include <memory>
 #include <mutex>
+#include <string>
+#include <utility>
 #include <vector>
 #include "GameRoom.hpp"
 #include "Macro.hpp"
 
-game::GameManager::GameManager(int maxPlayers)
-    : _maxPlayers(maxPlayers), _nextRoomId(1) {
+game::GameManager::GameManager(int maxPlayers, std::string recordDirectory)
+    : _maxPlayers(maxPlayers),
+      _recordDirectory(std::move(recordDirectory)),
+      _gamePool(std::make_shared<GamePool>()),
+      _nextRoomId(1) {
 }
 
 /**
@@ -26,19 +32,25 @@ game::GameManager::~GameManager() {
  * @brief Creates a new game room and registers it with the manager.
  *
  * If `roomName` is empty a default name "Room <id>" is assigned. If `password`
- * is non-empty the room password is set and the room is marked private.
+ * is non-empty the room password is set and the room is marked private. When a
+ * record directory is configured, the room's match is recorded there. The
+ * room takes its Game from the manager's game pool on first use.
  *
  * @param roomName Desired room name; empty to use a generated default.
  * @param password Optional password; non-empty value makes the room private.
+ * @param shard Network thread of the creating client, which the room is pinned
+ * to.
  * @return std::shared_ptr<game::GameRoom> Shared pointer to the newly created
  * room.
  */
 std::shared_ptr<game::GameRoom> game::GameManager::createRoom(
-    const std::string &roomName, const std::string &password) {
+    const std::string &roomName, const std::string &password,
+    std::size_t shard) {
   std::scoped_lock lock(_roomMutex);
   int roomId = _nextRoomId++;
 
-  auto room = std::make_shared<GameRoom>(roomId, _maxPlayers);
+  auto room =
+      std::make_shared<GameRoom>(roomId, _maxPlayers, _gamePool, shard);
 
   if (!roomName.empty()) {
     room->setRoomName(roomName);
@@ -51,6 +63,11 @@ std::shared_ptr<game::GameRoom> game::GameManager::createRoom(
     room->setPrivate(true);
   }
 
+  if (!_recordDirectory.empty()) {
+    room->setRecordPath(_recordDirectory + "/room_" + std::to_string(roomId) +
+                        "_" + std::to_string(std::time(nullptr)) + ".rrec");
+  }
+
   _rooms[roomId] = room;
   return room;
 }
@@ -146,14 +163,27 @@ bool game::GameManager::joinRoom(std::uint32_t roomId,
   return true;
 }
 
-bool game::GameManager::joinAnyRoom(std::shared_ptr<server::Client> client) {
+/**
+ * @brief Adds a client to the first joinable room, preferring rooms pinned to
+ * the client's own network thread so its room traffic stays on one thread.
+ *
+ * @param client Shared pointer to the client to add.
+ * @param shard Network thread owning the client's socket.
+ * @return true if the client joined a room, false if none could take it.
+ */
+bool game::GameManager::joinAnyRoom(std::shared_ptr<server::Client> client,
+                                    std::size_t shard) {
   std::scoped_lock lock(_roomMutex);
-  for (const auto &[id, room] : _rooms) {
-    if (room->canJoin()) {
-      if (room->addClient(client)) {
-        std::cout << "[ROOM] Client " << client->_player_id
-                  << " joined existing room " << id << std::endl;
-        return true;
+  for (bool sameShard : {true, false}) {
+    for (const auto &[id, room] : _rooms) {
+      if ((room->getShard() == shard) != sameShard)
+        continue;
+      if (room->canJoin()) {
+        if (room->addClient(client)) {
+          std::cout << "[ROOM] Client " << client->_player_id
+                    << " joined existing room " << id << std::endl;
+          return true;
+        }
       }
     }
   }
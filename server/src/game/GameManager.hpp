@@ -7,6 +7,7 @@
 #include <string>
 #include <unordered_map>
 #include <vector>
+#include "GamePool.hpp"
 #include "GameRoom.hpp"
 
 namespace server {
@@ -17,17 +18,19 @@ namespace game {
 
   class GameManager {
     public:
-      GameManager(int maxPlayers = 4);
+      GameManager(int maxPlayers = 4, std::string recordDirectory = "");
       ~GameManager();
 
       std::shared_ptr<GameRoom> createRoom(const std::string &roomName = "",
-                                           const std::string &password = "");
+                                           const std::string &password = "",
+                                           std::size_t shard = 0);
       bool destroyRoom(std::uint32_t roomId);
       std::shared_ptr<GameRoom> findAvailableRoom();
       std::shared_ptr<GameRoom> getRoom(std::uint32_t roomId) const;
       bool joinRoom(std::uint32_t roomId,
                     std::shared_ptr<server::Client> client);
-      bool joinAnyRoom(std::shared_ptr<server::Client> client);
+      bool joinAnyRoom(std::shared_ptr<server::Client> client,
+                       std::size_t shard = 0);
       void leaveRoom(std::shared_ptr<server::Client> client);
       std::vector<std::shared_ptr<GameRoom>> getAllRooms() const;
       void removeEmptyRooms();
@@ -37,6 +40,8 @@ namespace game {
     private:
       std::unordered_map<std::uint32_t, std::shared_ptr<game::GameRoom>> _rooms;
       int _maxPlayers;
+      std::string _recordDirectory;
+      std::shared_ptr<GamePool> _gamePool;
       std::atomic<std::uint32_t> _nextRoomId;
       mutable std::mutex _roomMutex;
   };
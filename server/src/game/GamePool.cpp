@@ -0,0 +1,51 @@
+#include "GamePool.hpp"
+#include <memory>
+#include <mutex>
+#include <random>
+#include <utility>
+
+game::GamePool::GamePool(std::size_t capacity) : _capacity(capacity) {
+  _games.reserve(capacity);
+}
+
+/**
+ * @brief Take an idle game from the pool, or construct a new one if the pool
+ * is empty.
+ *
+ * @return std::unique_ptr<game::Game> A game ready to host a new match.
+ */
+std::unique_ptr<game::Game> game::GamePool::acquire() {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_games.empty()) {
+      auto game = std::move(_games.back());
+      _games.pop_back();
+      return game;
+    }
+  }
+  return std::make_unique<Game>();
+}
+
+/**
+ * @brief Reset a game that is no longer used by its room and keep it for the
+ * next room, or destroy it if the pool is already full.
+ *
+ * The reset runs outside the pool lock and only touches the entities that
+ * were live in the finished match.
+ *
+ * @param game Game to give back; ignored if null.
+ */
+void game::GamePool::release(std::unique_ptr<Game> game) {
+  if (!game)
+    return;
+  game->reset(std::random_device{}());
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (_games.size() < _capacity)
+    _games.push_back(std::move(game));
+}
+
+std::size_t game::GamePool::getIdleCount() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _games.size();
+}
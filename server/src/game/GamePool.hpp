@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "Game.hpp"
+#include "Macro.hpp"
+
+namespace game {
+
+  /**
+   * @brief Keeps finished Game instances around so that new rooms reuse them
+   * instead of registering components and allocating ECS storage again.
+   *
+   * A released game is reset (stopped, entities cleared, counters rewound,
+   * reseeded) before being stored. At most `capacity` idle games are kept;
+   * extra ones are destroyed.
+   */
+  class GamePool {
+    public:
+      explicit GamePool(std::size_t capacity = GAME_POOL_SIZE);
+      GamePool(const GamePool &) = delete;
+      GamePool &operator=(const GamePool &) = delete;
+
+      std::unique_ptr<Game> acquire();
+      void release(std::unique_ptr<Game> game);
+
+      std::size_t getIdleCount() const;
+
+    private:
+      std::vector<std::unique_ptr<Game>> _games;
+      std::size_t _capacity;
+      mutable std::mutex _mutex;
+  };
+
+}  // namespace game
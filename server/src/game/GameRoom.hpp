@@ -2,12 +2,16 @@
 
 #include <asio/steady_timer.hpp>
 #include <atomic>
+#include <iostream>
 #include <memory>
+#include <mutex>
 #include <shared_mutex>
 #include <string>
 #include "Client.hpp"
 #include "Game.hpp"
+#include "GamePool.hpp"
 #include "Macro.hpp"
+#include "ReplicationScheduler.hpp"
 
 namespace game {
 
@@ -23,17 +27,25 @@ namespace game {
       /**
        * @brief Constructs a GameRoom with the given identifier and capacity.
        *
-       * Initializes the room in the WAITING state, creates an internal Game
-       * instance, sets the countdown to 0, and clears any countdown timer.
+       * Initializes the room in the WAITING state, sets the countdown to 0,
+       * and clears any countdown timer. The Game is not created here but on
+       * first use (see getGame()), so rooms that never get a player never
+       * allocate one.
        *
        * @param room_id Numeric identifier for the room.
        * @param max_players Maximum number of players allowed in the room.
+       * @param game_pool Pool the Game is taken from and given back to; a
+       * fresh Game is built and destroyed with the room when null.
+       * @param shard Network thread the room is pinned to.
        */
-      GameRoom(std::uint32_t room_id, std::uint16_t max_players)
+      GameRoom(std::uint32_t room_id, std::uint16_t max_players,
+               std::shared_ptr<GamePool> game_pool = nullptr,
+               std::size_t shard = 0)
           : _room_id(room_id),
             _max_players(max_players),
+            _shard(shard),
             _state(RoomStatus::WAITING),
-            _game(std::make_unique<Game>()),
+            _game_pool(std::move(game_pool)),
             _countdown(0),
             _countdown_timer(nullptr) {
       }
@@ -42,11 +54,14 @@ namespace game {
        * @brief Cleans up the room and stops any active game or countdown.
        *
        * Ensures the room is transitioned to a stopped/finished state, cancels
-       * any pending countdown timer, and stops the contained Game before
-       * destruction.
+       * any pending countdown timer, stops the contained Game, and gives it
+       * back to the game pool. This runs once the last reference to the room
+       * is gone, so nothing can still be using the Game.
        */
       ~GameRoom() {
         stop();
+        if (_game_pool && _game_created.load(std::memory_order_acquire))
+          _game_pool->release(std::move(_game));
       }
 
       /**
@@ -58,6 +73,14 @@ namespace game {
         return _room_id;
       }
 
+      /**
+       * @brief Network thread (socket shard) the room is pinned to: its
+       * events, broadcasts and countdown run there.
+       */
+      std::size_t getShard() const {
+        return _shard;
+      }
+
       /**
        * @brief Gets the room's name.
        *
@@ -138,6 +161,8 @@ namespace game {
           return false;
         }
         _clients.push_back(client);
+        _clients_snapshot = std::make_shared<
+            const std::vector<std::shared_ptr<server::Client>>>(_clients);
         client->_room_id = _room_id;
         return true;
       }
@@ -157,6 +182,8 @@ namespace game {
           if ((*it)->_player_id == player_id) {
             (*it)->_room_id = NO_ROOM;
             _clients.erase(it);
+            _clients_snapshot = std::make_shared<
+                const std::vector<std::shared_ptr<server::Client>>>(_clients);
             break;
           }
         }
@@ -168,26 +195,72 @@ namespace game {
       }
 
       /**
-       * @brief Accesses the room's contained Game instance.
+       * @brief Immutable copy of the client list, rebuilt on every join and
+       * leave.
+       *
+       * Broadcast paths run far more often than membership changes, so they
+       * share this snapshot instead of copying the list: taking it only costs
+       * a reference count increment.
+       *
+       * @return Snapshot of the room's clients; never null.
+       */
+      std::shared_ptr<const std::vector<std::shared_ptr<server::Client>>>
+      getClientsSnapshot() const {
+        std::shared_lock<std::shared_mutex> lock(_mutex);
+        return _clients_snapshot;
+      }
+
+      /**
+       * @brief Scheduler fitting the room's state updates into its clients'
+       * send budgets; only used on the room's network thread.
+       */
+      server::ReplicationScheduler &getReplicationScheduler() {
+        return _replication;
+      }
+
+      /**
+       * @brief Accesses the room's contained Game instance, taking it from the
+       * game pool on first use.
+       *
+       * The first call also starts recording the match if a record path was
+       * set. Later calls only pay for an already-initialized once flag.
        *
        * @return Game& Reference to the room's Game instance.
        */
       Game &getGame() {
+        std::call_once(_game_once, [this]() {
+          _game = _game_pool ? _game_pool->acquire() : std::make_unique<Game>();
+          if (!_record_path.empty() && _game->startRecording(_record_path)) {
+            std::cout << "[WORLD] Recording room " << _room_id << " to "
+                      << _record_path << std::endl;
+          }
+          _game_created.store(true, std::memory_order_release);
+        });
         return *_game;
       }
 
+      /**
+       * @brief Set the file the room's match will be recorded to once its
+       * Game is created. Must be called before the first getGame().
+       *
+       * @param path Path of the recording; empty to disable recording.
+       */
+      void setRecordPath(const std::string &path) {
+        _record_path = path;
+      }
+
       /**
        * @brief Transition the room to the running state and start the contained
        * game.
        *
-       * Attempts to change the room state to RUNNING. If the current state is
-       * STARTING or, if not, WAITING, the state is set to RUNNING and the
-       * contained Game's start() method is invoked.
+       * If the current state is STARTING, the state is set to RUNNING and the
+       * contained Game, taken from the pool through getGame() if no player
+       * did so yet, is started. In any other state this has no effect.
        */
       void start() {
         RoomStatus expected = RoomStatus::STARTING;
         if (_state.compare_exchange_strong(expected, RoomStatus::RUNNING)) {
-          _game->start();
+          getGame().start();
         }
       }
 
@@ -210,7 +283,7 @@ namespace game {
           }
         }
         _state.store(RoomStatus::FINISHED);
-        if (_game) {
+        if (_game_created.load(std::memory_order_acquire)) {
           _game->stop();
         }
       }
@@ -328,15 +401,18 @@ namespace game {
        * @param seconds Number of seconds to count down from (must be >= 0).
        * @param timer Shared pointer to an asio::steady_timer used to drive the
        * countdown; stored if the transition succeeds.
+       * @return true if this call started the countdown, false if the room
+       * was not WAITING; only the caller that started it may drive it.
        */
-      void startCountdown(int seconds,
+      bool startCountdown(int seconds,
                           std::shared_ptr<asio::steady_timer> timer) {
         std::lock_guard<std::shared_mutex> lock(_mutex);
         RoomStatus expected = RoomStatus::WAITING;
-        if (_state.compare_exchange_strong(expected, RoomStatus::STARTING)) {
-          _countdown = seconds;
-          _countdown_timer = timer;
-        }
+        if (!_state.compare_exchange_strong(expected, RoomStatus::STARTING))
+          return false;
+        _countdown = seconds;
+        _countdown_timer = timer;
+        return true;
       }
 
       /**
@@ -367,16 +443,25 @@ namespace game {
       std::uint32_t _room_id;
       std::string _room_name;
       const std::uint16_t _max_players;
+      const std::size_t _shard;
       std::string _password;
 
       bool _is_private = false;
 
       std::atomic<RoomStatus> _state;
+      std::shared_ptr<GamePool> _game_pool;
       std::unique_ptr<Game> _game;
+      std::once_flag _game_once;
+      std::atomic<bool> _game_created{false};
+      std::string _record_path;
       std::atomic<int> _countdown;
       std::shared_ptr<asio::steady_timer> _countdown_timer;
       std::vector<std::shared_ptr<server::Client>> _clients;
+      std::shared_ptr<const std::vector<std::shared_ptr<server::Client>>>
+          _clients_snapshot = std::make_shared<
+              const std::vector<std::shared_ptr<server::Client>>>();
       mutable std::shared_mutex _mutex;
+      server::ReplicationScheduler _replication;
   };
 
 }  // namespace game
\ No newline at end of file
@@ -0,0 +1,143 @@
+#include "RoomRecorder.hpp"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <limits>
+
+game::RoomRecorder::~RoomRecorder() {
+  close();
+}
+
+/**
+ * @brief Create the log file and write its header (magic, version, seed).
+ *
+ * @param path Path of the log file to create.
+ * @param seed Seed of the room's RNG.
+ * @return true if the file is ready to record, false otherwise.
+ */
+bool game::RoomRecorder::open(const std::string &path, std::uint32_t seed) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _file.open(path, std::ios::binary | std::ios::trunc);
+  if (!_file.is_open()) {
+    std::cerr << "[WARNING] Could not open room recording " << path
+              << std::endl;
+    return false;
+  }
+  _file.write(RECORD_MAGIC, sizeof(RECORD_MAGIC));
+  write(RECORD_VERSION);
+  write(seed);
+  return true;
+}
+
+void game::RoomRecorder::close() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (_file.is_open())
+    _file.close();
+}
+
+bool game::RoomRecorder::isOpen() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _file.is_open();
+}
+
+void game::RoomRecorder::recordTick(float deltaTime) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (!_file.is_open())
+    return;
+  write(RecordType::Tick);
+  write(deltaTime);
+}
+
+void game::RoomRecorder::recordJoin(std::uint32_t player_id,
+                                    const std::string &name) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (!_file.is_open())
+    return;
+  const auto length = static_cast<std::uint8_t>(std::min<std::size_t>(
+      name.size(), std::numeric_limits<std::uint8_t>::max()));
+  write(RecordType::Join);
+  write(player_id);
+  write(length);
+  _file.write(name.data(), length);
+}
+
+void game::RoomRecorder::recordLeave(std::uint32_t player_id) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (!_file.is_open())
+    return;
+  write(RecordType::Leave);
+  write(player_id);
+}
+
+void game::RoomRecorder::recordInput(std::uint32_t player_id,
+                                     std::uint8_t input,
+                                     std::uint32_t client_tick) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (!_file.is_open())
+    return;
+  write(RecordType::Input);
+  write(player_id);
+  write(input);
+  write(client_tick);
+}
+
+void game::RoomRecorder::recordShoot(std::uint32_t player_id,
+                                     std::uint32_t rewind_ticks) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (!_file.is_open())
+    return;
+  write(RecordType::Shoot);
+  write(player_id);
+  write(rewind_ticks);
+}
+
+/**
+ * @brief Open a room recording and read its header.
+ *
+ * @param path Path of the log file.
+ * @return true if the file is a recording of a supported version.
+ */
+bool game::RoomRecordReader::open(const std::string &path) {
+  _file.open(path, std::ios::binary);
+  if (!_file.is_open())
+    return false;
+
+  char magic[sizeof(RECORD_MAGIC)];
+  std::uint8_t version = 0;
+  if (!_file.read(magic, sizeof(magic)) ||
+      std::memcmp(magic, RECORD_MAGIC, sizeof(magic)) != 0 || !read(version) ||
+      version != RECORD_VERSION || !read(_seed))
+    return false;
+  return true;
+}
+
+/**
+ * @brief Read the next record of the log.
+ *
+ * @param record Filled with the record on success.
+ * @return false at the end of the log or on a truncated/unknown record.
+ */
+bool game::RoomRecordReader::next(Record &record) {
+  if (!read(record.type))
+    return false;
+
+  switch (record.type) {
+    case RecordType::Tick:
+      return read(record.delta_time);
+    case RecordType::Join: {
+      std::uint8_t length = 0;
+      if (!read(record.player_id) || !read(length))
+        return false;
+      record.name.resize(length);
+      return static_cast<bool>(_file.read(record.name.data(), length));
+    }
+    case RecordType::Leave:
+      return read(record.player_id);
+    case RecordType::Input:
+      return read(record.player_id) && read(record.input) &&
+             read(record.client_tick);
+    case RecordType::Shoot:
+      return read(record.player_id) && read(record.rewind_ticks);
+  }
+  return false;
+}
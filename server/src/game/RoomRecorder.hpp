@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+
+namespace game {
+
+  constexpr char RECORD_MAGIC[4] = {'R', 'R', 'E', 'C'};
+  constexpr std::uint8_t RECORD_VERSION = 1;
+
+  /**
+   * @brief Kinds of records stored in a room recording, each written as one
+   * byte followed by its payload.
+   */
+  enum class RecordType : std::uint8_t {
+    Tick = 1,    // f32 delta time; simulate one tick with what precedes it
+    Join = 2,    // u32 player id, u8 name length, name bytes
+    Leave = 3,   // u32 player id
+    Input = 4,   // u32 player id, u8 input flags, u32 client tick
+    Shoot = 5    // u32 player id, u32 rewind ticks
+  };
+
+  /**
+   * @brief Writes a compact binary log of everything that drives a room's
+   * simulation: the RNG seed, then joins, leaves, shots and applied inputs,
+   * each closed by a Tick record carrying the tick's delta time.
+   *
+   * Records are appended in the order they happen under a mutex, since the
+   * network thread and the game thread both write to it. Replaying the log
+   * with the same seed reproduces the match at tick granularity.
+   */
+  class RoomRecorder {
+    public:
+      RoomRecorder() = default;
+      ~RoomRecorder();
+
+      bool open(const std::string &path, std::uint32_t seed);
+      void close();
+      bool isOpen() const;
+
+      void recordTick(float deltaTime);
+      void recordJoin(std::uint32_t player_id, const std::string &name);
+      void recordLeave(std::uint32_t player_id);
+      void recordInput(std::uint32_t player_id, std::uint8_t input,
+                       std::uint32_t client_tick);
+      void recordShoot(std::uint32_t player_id, std::uint32_t rewind_ticks);
+
+    private:
+      template <typename T>
+      void write(const T &value) {
+        _file.write(reinterpret_cast<const char *>(&value), sizeof(T));
+      }
+
+      std::ofstream _file;
+      mutable std::mutex _mutex;
+  };
+
+  /**
+   * @brief Sequential reader for logs written by RoomRecorder.
+   */
+  class RoomRecordReader {
+    public:
+      struct Record {
+          RecordType type;
+          float delta_time = 0.0f;
+          std::uint32_t player_id = 0;
+          std::string name;
+          std::uint8_t input = 0;
+          std::uint32_t client_tick = 0;
+          std::uint32_t rewind_ticks = 0;
+      };
+
+      bool open(const std::string &path);
+      std::uint32_t getSeed() const {
+        return _seed;
+      }
+      bool next(Record &record);
+
+    private:
+      template <typename T>
+      bool read(T &value) {
+        return static_cast<bool>(
+            _file.read(reinterpret_cast<char *>(&value), sizeof(T)));
+      }
+
+      std::ifstream _file;
+      std::uint32_t _seed = 0;
+  };
+
+}  // namespace game
@@ -22,7 +22,11 @@ int main(int ac, char **av) {
     parser.parseProperties();
 
     server::Server server(parser.getPort(), parser.getMaxClients(),
-                          parser.getClientsPerRoom());
+                          parser.getClientsPerRoom(),
+                          parser.getRecordDirectory(),
+                          parser.getNetworkThreads(),
+                          parser.getAggregationMtu(),
+                          parser.getClientSendRate());
 
     std::cout << "Starting server on port " << parser.getPort() << "..."
               << std::endl;
@@ -0,0 +1,79 @@
+#pragma once
+#include <cstddef>
+#include "Packet.hpp"
+#include "PacketHandler.hpp"
+#include "PacketRegistry.hpp"
+
+namespace packet {
+
+  /**
+   * @brief Signature of a server packet handler entry in the dispatch table.
+   */
+  using PacketHandlerFn = int (*)(server::Server &server,
+                                  server::Client &client, const char *data,
+                                  std::size_t size);
+
+  /**
+   * @brief Run `Handler` on a packet. Handlers are stateless, so the object
+   * lives on the stack and the qualified call is resolved at compile time.
+   */
+  template <typename Handler>
+  int invokeHandler(server::Server &server, server::Client &client,
+                    const char *data, std::size_t size) {
+    Handler handler;
+    return handler.Handler::handlePacket(server, client, data, size);
+  }
+
+  constexpr PacketDispatchTable<PacketHandlerFn> makeServerDispatchTable() {
+    PacketDispatchTable<PacketHandlerFn> table{};
+    bindHandler<PacketType::ChatMessage>(
+        table, &invokeHandler<ChatMessageHandler>);
+    bindHandler<PacketType::PlayerInfo>(table,
+                                        &invokeHandler<PlayerInfoHandler>);
+    bindHandler<PacketType::Heartbeat>(
+        table, &invokeHandler<HeartbeatPlayerHandler>);
+    bindHandler<PacketType::PlayerDisconnected>(
+        table, &invokeHandler<PlayerDisconnectedHandler>);
+    bindHandler<PacketType::PlayerShoot>(table,
+                                         &invokeHandler<PlayerShootHandler>);
+    bindHandler<PacketType::CreateRoom>(table,
+                                        &invokeHandler<CreateRoomHandler>);
+    bindHandler<PacketType::JoinRoom>(table, &invokeHandler<JoinRoomHandler>);
+    bindHandler<PacketType::LeaveRoom>(table,
+                                       &invokeHandler<LeaveRoomHandler>);
+    bindHandler<PacketType::ListRoom>(table, &invokeHandler<ListRoomHandler>);
+    bindHandler<PacketType::MatchmakingRequest>(
+        table, &invokeHandler<MatchmakingRequestHandler>);
+    bindHandler<PacketType::PlayerInput>(table,
+                                         &invokeHandler<PlayerInputHandler>);
+    bindHandler<PacketType::Ping>(table, &invokeHandler<PingHandler>);
+    bindHandler<PacketType::RequestChallenge>(
+        table, &invokeHandler<RequestChallengeHandler>);
+    bindHandler<PacketType::ScoreboardRequest>(
+        table, &invokeHandler<ScoreboardRequestHandler>);
+    return table;
+  }
+
+  /**
+   * @brief Routes received packets to their handler through a flat table
+   * indexed by packet type, built at compile time: no allocation, hashing or
+   * virtual call per packet.
+   */
+  class PacketDispatcher {
+    public:
+      /**
+       * @brief Get the handler of a packet type.
+       *
+       * @return PacketHandlerFn The handler, or `nullptr` if the server does
+       * not handle this packet type.
+       */
+      PacketHandlerFn getHandler(PacketType type) const {
+        return _handlers[static_cast<std::uint8_t>(type)];
+      }
+
+    private:
+      static constexpr PacketDispatchTable<PacketHandlerFn> _handlers =
+          makeServerDispatchTable();
+  };
+
+}  // namespace packet
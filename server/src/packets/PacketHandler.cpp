@@ -42,14 +42,11 @@ void packet::ResponseHelper::sendJoinRoomResponse(server::Server &server,
     return;
   }
 
-  server.getNetworkManager().sendToClient(
-      client._player_id,
-      reinterpret_cast<const char *>(serializedBuffer.data()),
-      serializedBuffer.size());
+  auto buffer = std::make_shared<std::vector<std::uint8_t>>(
+      std::move(serializedBuffer));
+  server.getNetworkManager().sendToClient(client._player_id, buffer);
 
-  client.addUnacknowledgedPacket(
-      response.sequence_number,
-      std::make_shared<std::vector<uint8_t>>(serializedBuffer));
+  client.addUnacknowledgedPacket(response.sequence_number, buffer);
 }
 
 /**
@@ -79,14 +76,11 @@ void packet::ResponseHelper::sendMatchmakingResponse(
               << client._player_id << std::endl;
     return;
   }
-  server.getNetworkManager().sendToClient(
-      client._player_id,
-      reinterpret_cast<const char *>(serializedBuffer.data()),
-      serializedBuffer.size());
+  auto buffer = std::make_shared<std::vector<std::uint8_t>>(
+      std::move(serializedBuffer));
+  server.getNetworkManager().sendToClient(client._player_id, buffer);
 
-  client.addUnacknowledgedPacket(
-      response.sequence_number,
-      std::make_shared<std::vector<uint8_t>>(serializedBuffer));
+  client.addUnacknowledgedPacket(response.sequence_number, buffer);
 }
 
 /**
@@ -108,7 +102,7 @@ int packet::ChatMessageHandler::handlePacket(server::Server &server,
                                              server::Client &client,
                                              const char *data,
                                              std::size_t size) {
-  serialization::Buffer buffer(data, data + size);
+  auto buffer = serialization::asBytes(data, size);
 
   auto deserializedPacket =
       serialization::BitserySerializer::deserialize<ChatMessagePacket>(buffer);
@@ -137,36 +131,32 @@ int packet::ChatMessageHandler::handlePacket(server::Server &server,
 
   broadcast::Broadcast::broadcastMessageToRoom(server.getNetworkManager(),
                                                roomClients, validatedPacket);
-  auto ackPacket = PacketBuilder::makeAckPacket(validatedPacket.sequence_number,
-                                                client._player_id);
-  auto ackBuffer = std::make_shared<std::vector<uint8_t>>(
-      serialization::BitserySerializer::serialize(ackPacket));
-  server.getNetworkManager().sendToClient(
-      client._player_id, reinterpret_cast<const char *>(ackBuffer->data()),
-      ackBuffer->size());
   return OK;
 }
 
 /**
- * @brief Handle a PlayerInfoPacket: register the player's name, update database
- * status, and acknowledge the sender.
+ * @brief Handle a PlayerInfoPacket: register the player's name and update
+ * database status.
  *
- * Updates the client's stored player name, attempts to add the player to the
- * database and mark them connected, and sends an AckPacket for the received
- * sequence number.
+ * Updates the client's stored player name and attempts to add the player to
+ * the database and mark them connected. If the client advertises
+ * CAPABILITY_AGGREGATION, the packets sent to it are bundled from now on, and
+ * if it advertises CAPABILITY_COMPACT, they are sent in their compact encoding
+ * when they have one. The packet is acknowledged by the ack header of the
+ * next datagram sent to the client.
  *
  * @param server Server managing rooms, game state, and networking.
  * @param client Client that sent the packet; its `_player_name` may be updated.
  * @param data Pointer to the raw PlayerInfoPacket bytes.
  * @param size Size of the data buffer in bytes.
- * @return int `OK` if the packet was processed and an acknowledgement was sent,
- * `KO` if deserialization failed or the packet was invalid.
+ * @return int `OK` if the packet was processed, `KO` if deserialization failed
+ * or the packet was invalid.
  */
 int packet::PlayerInfoHandler::handlePacket(server::Server &server,
                                             server::Client &client,
                                             const char *data,
                                             std::size_t size) {
-  serialization::Buffer buffer(data, data + size);
+  auto buffer = serialization::asBytes(data, size);
 
   auto deserializedPacket =
       serialization::BitserySerializer::deserialize<PlayerInfoPacket>(buffer);
@@ -182,6 +172,14 @@ int packet::PlayerInfoHandler::handlePacket(server::Server &server,
   std::string name = packet.name;
 
   client._player_name = name;
+  if ((packet.capabilities & CAPABILITY_AGGREGATION) != 0 &&
+      server.getNetworkManager().enableAggregation(client._route))
+    std::cout << "[INFO] Bundling packets sent to client " << client._player_id
+              << std::endl;
+  if ((packet.capabilities & CAPABILITY_COMPACT) != 0 &&
+      server.getNetworkManager().enableCompactEncoding(client._route))
+    std::cout << "[INFO] Compact encoding for client " << client._player_id
+              << std::endl;
 
   auto playerData = server.getDatabaseManager().getPlayerByUsername(name);
   if (!playerData.has_value()) {
@@ -206,12 +204,6 @@ int packet::PlayerInfoHandler::handlePacket(server::Server &server,
 
   std::cout << "[INFO] Client " << client._player_id << " (" << name
             << ") registered in menu" << std::endl;
-  auto ackPacket =
-      PacketBuilder::makeAckPacket(packet.sequence_number, client._player_id);
-  auto ackBuffer = std::make_shared<std::vector<uint8_t>>(
-      serialization::BitserySerializer::serialize(ackPacket));
-
-  server.getNetworkManager().sendToClient(client._player_id, ackBuffer);
   return OK;
 }
 
@@ -232,7 +224,7 @@ int packet::PlayerInfoHandler::handlePacket(server::Server &server,
 int packet::HeartbeatPlayerHandler::handlePacket(
     [[maybe_unused]] server::Server &server, server::Client &client,
     const char *data, std::size_t size) {
-  serialization::Buffer buffer(data, data + size);
+  auto buffer = serialization::asBytes(data, size);
   auto deserializedPacket =
       serialization::BitserySerializer::deserialize<HeartbeatPlayerPacket>(
           buffer);
@@ -252,8 +244,13 @@ int packet::HeartbeatPlayerHandler::handlePacket(
 }
 
 /**
- * @brief Handle a PlayerShootPacket from a client: spawn a projectile, send an
- * ack to the sender, and broadcast the shot to all clients in the room.
+ * @brief Handle a PlayerShootPacket from a client: spawn a projectile and
+ * broadcast the shot to all clients in the room.
+ *
+ * The projectile carries the shooter's one-way delay converted to ticks so
+ * that hit validation can rewind enemies to what the shooter was seeing. The
+ * delay is half the round trip the server measured from the client's acks,
+ * never a figure the client reports about itself.
  *
  * @param data Pointer to the serialized PlayerShootPacket buffer.
  * @param size Size of the serialized buffer in bytes.
@@ -265,7 +262,7 @@ int packet::PlayerShootHandler::handlePacket(server::Server &server,
                                              server::Client &client,
                                              const char *data,
                                              std::size_t size) {
-  serialization::Buffer buffer(data, data + size);
+  auto buffer = serialization::asBytes(data, size);
 
   auto deserializedPacket =
       serialization::BitserySerializer::deserialize<PlayerShootPacket>(buffer);
@@ -283,12 +280,12 @@ int packet::PlayerShootHandler::handlePacket(server::Server &server,
     return KO;
   }
 
-  auto player = room->getGame().getPlayer(client._player_id);
+  auto player = room->getGame().getPlayerState(client._player_id);
   if (!player) {
     return KO;
   }
 
-  std::pair<float, float> pos = player->getPosition();
+  std::pair<float, float> pos = player->position;
   const float speed = PROJECTILE_SPEED;
 
   float vx = speed;
@@ -309,37 +306,29 @@ int packet::PlayerShootHandler::handlePacket(server::Server &server,
     lastSeq = lastProcessedOpt.value();
   }
   if (packet.sequence_number <= lastSeq) {
-    server.getNetworkManager().sendToClient(
-        client._player_id,
-        std::make_shared<std::vector<uint8_t>>(
-            serialization::BitserySerializer::serialize(
-                PacketBuilder::makeAckPacket(packet.sequence_number,
-                                             client._player_id))));
     return OK;
   }
-  auto projectile = room->getGame().createProjectile(
-      projectileId, client._player_id, projectileType, pos.first, pos.second,
-      vx, vy);
-
-  if (!projectile) {
+  const std::uint32_t oneWayMs =
+      std::min(static_cast<std::uint32_t>(client.getSmoothedRtt().count() / 2),
+               MAX_LAG_COMPENSATION_MS);
+  const std::uint32_t rewindTicks =
+      oneWayMs * TPS / static_cast<std::uint32_t>(CONVERT_MS_TO_S);
+  if (!room->getGame().createProjectile(projectileId, client._player_id,
+                                        projectileType, pos.first,
+                                        pos.second, vx, vy, rewindTicks)) {
     return KO;
   }
+  if (auto *recorder = room->getGame().getRecorder())
+    recorder->recordShoot(client._player_id, rewindTicks);
 
   auto playerShotPacket = PacketBuilder::makePlayerShoot(
       pos.first, pos.second, projectileType,
       room->getGame().fetchAndIncrementSequenceNumber());
-  auto playerShotBuffer = std::make_shared<std::vector<uint8_t>>(
-      serialization::BitserySerializer::serialize(playerShotPacket));
 
   server.setLastProcessedSeq(client._player_id, packet.sequence_number);
-  auto ackPacket =
-      PacketBuilder::makeAckPacket(packet.sequence_number, client._player_id);
-  auto ackBuffer = std::make_shared<std::vector<uint8_t>>(
-      serialization::BitserySerializer::serialize(ackPacket));
-  server.getNetworkManager().sendToClient(client._player_id, ackBuffer);
 
   auto roomClients = room->getClients();
-  broadcast::Broadcast::broadcastPlayerShootToRoom(
+  auto playerShotBuffer = broadcast::Broadcast::broadcastPlayerShootToRoom(
       server.getNetworkManager(), roomClients, playerShotPacket);
 
   for (auto &client : roomClients) {
@@ -366,7 +355,7 @@ int packet::PlayerDisconnectedHandler::handlePacket(server::Server &server,
                                                     server::Client &client,
                                                     const char *data,
                                                     std::size_t size) {
-  serialization::Buffer buffer(data, data + size);
+  auto buffer = serialization::asBytes(data, size);
 
   auto deserializedPacket =
       serialization::BitserySerializer::deserialize<PlayerDisconnectPacket>(
@@ -390,14 +379,15 @@ int packet::PlayerDisconnectedHandler::handlePacket(server::Server &server,
   client._connected = false;
 
   if (wasConnected) {
-    server.setPlayerCount(server.getPlayerCount() - 1);
+    server.decrementPlayerCount();
   }
 
   if (client._room_id != NO_ROOM) {
     auto room = server.getGameManager().getRoom(client._room_id);
     if (room) {
-      auto player = room->getGame().getPlayer(client._player_id);
-      if (player) {
+      if (room->getGame().getPlayerState(client._player_id)) {
+        if (auto *recorder = room->getGame().getRecorder())
+          recorder->recordLeave(client._player_id);
         room->getGame().destroyPlayer(client._player_id);
       }
 
@@ -407,13 +397,7 @@ int packet::PlayerDisconnectedHandler::handlePacket(server::Server &server,
                   << client._player_id << std::endl;
       }
 
-      std::shared_ptr<server::Client> sharedClient;
-      for (const auto &entry : server.getClients()) {
-        if (entry && entry->_player_id == client._player_id) {
-          sharedClient = entry;
-          break;
-        }
-      }
+      auto sharedClient = server.getClientById(client._player_id);
       if (sharedClient) {
         server.getGameManager().leaveRoom(sharedClient);
       }
@@ -422,10 +406,9 @@ int packet::PlayerDisconnectedHandler::handlePacket(server::Server &server,
       auto &game = room->getGame();
       auto disconnectPacket = PacketBuilder::makePlayerDisconnect(
           client._player_id, game.fetchAndIncrementSequenceNumber());
-      auto disconnectBuffer = std::make_shared<std::vector<std::uint8_t>>(
-          serialization::BitserySerializer::serialize(disconnectPacket));
-      broadcast::Broadcast::broadcastPlayerDisconnectToRoom(
-          server.getNetworkManager(), roomClients, disconnectPacket);
+      auto disconnectBuffer =
+          broadcast::Broadcast::broadcastPlayerDisconnectToRoom(
+              server.getNetworkManager(), roomClients, disconnectPacket);
       for (const auto &roomClient : roomClients) {
         if (roomClient && roomClient->_player_id != client._player_id) {
           roomClient->addUnacknowledgedPacket(disconnectPacket.sequence_number,
@@ -436,9 +419,7 @@ int packet::PlayerDisconnectedHandler::handlePacket(server::Server &server,
       auto chatMessagePacket = PacketBuilder::makeChatMessage(
           msg, SERVER_SENDER_ID, 255, 255, 0, 255,
           game.fetchAndIncrementSequenceNumber());
-      auto chatMessageBuffer = std::make_shared<std::vector<std::uint8_t>>(
-          serialization::BitserySerializer::serialize(chatMessagePacket));
-      broadcast::Broadcast::broadcastMessageToRoom(
+      auto chatMessageBuffer = broadcast::Broadcast::broadcastMessageToRoom(
           server.getNetworkManager(), roomClients, chatMessagePacket);
       for (const auto &roomClient : roomClients) {
         if (roomClient && roomClient->_player_id != client._player_id) {
@@ -472,7 +453,7 @@ int packet::CreateRoomHandler::handlePacket(server::Server &server,
                                             server::Client &client,
                                             const char *data,
                                             std::size_t size) {
-  serialization::Buffer buffer(data, data + size);
+  auto buffer = serialization::asBytes(data, size);
 
   auto deserializedPacket =
       serialization::BitserySerializer::deserialize<CreateRoomPacket>(buffer);
@@ -497,13 +478,10 @@ int packet::CreateRoomHandler::handlePacket(server::Server &server,
                         : packet.sequence_number);
     auto serializedBuffer =
         serialization::BitserySerializer::serialize(response);
-    server.getNetworkManager().sendToClient(
-        client._player_id,
-        reinterpret_cast<const char *>(serializedBuffer.data()),
-        serializedBuffer.size());
-    client.addUnacknowledgedPacket(
-        response.sequence_number,
-        std::make_shared<std::vector<std::uint8_t>>(serializedBuffer));
+    auto buffer = std::make_shared<std::vector<std::uint8_t>>(
+        std::move(serializedBuffer));
+    server.getNetworkManager().sendToClient(client._player_id, buffer);
+    client.addUnacknowledgedPacket(response.sequence_number, buffer);
     return OK;
   }
 
@@ -512,7 +490,9 @@ int packet::CreateRoomHandler::handlePacket(server::Server &server,
 
   std::string actualPassword = packet.is_private ? password : "";
 
-  auto newRoom = server.getGameManager().createRoom(roomName, actualPassword);
+  auto newRoom = server.getGameManager().createRoom(
+      roomName, actualPassword,
+      server.getNetworkManager().getClientShard(client._player_id));
 
   if (!newRoom) {
     std::cerr << "[ERROR] Failed to create room for client "
@@ -570,14 +550,11 @@ int packet::CreateRoomHandler::handlePacket(server::Server &server,
     return KO;
   }
 
-  server.getNetworkManager().sendToClient(
-      client._player_id,
-      reinterpret_cast<const char *>(serializedBuffer.data()),
-      serializedBuffer.size());
+  auto responseBuffer = std::make_shared<std::vector<std::uint8_t>>(
+      std::move(serializedBuffer));
+  server.getNetworkManager().sendToClient(client._player_id, responseBuffer);
 
-  client.addUnacknowledgedPacket(
-      response.sequence_number,
-      std::make_shared<std::vector<std::uint8_t>>(serializedBuffer));
+  client.addUnacknowledgedPacket(response.sequence_number, responseBuffer);
 
   std::cout << "[CREATE ROOM] Client " << client._player_id
             << " created and joined room " << newRoom->getRoomId() << " ("
@@ -601,7 +578,7 @@ int packet::CreateRoomHandler::handlePacket(server::Server &server,
 int packet::JoinRoomHandler::handlePacket(server::Server &server,
                                           server::Client &client,
                                           const char *data, std::size_t size) {
-  serialization::Buffer buffer(data, data + size);
+  auto buffer = serialization::asBytes(data, size);
 
   auto deserializedPacket =
       serialization::BitserySerializer::deserialize<JoinRoomPacket>(buffer);
@@ -614,14 +591,6 @@ int packet::JoinRoomHandler::handlePacket(server::Server &server,
 
   const JoinRoomPacket &packet = deserializedPacket.value();
 
-  auto ackPacket =
-      PacketBuilder::makeAckPacket(packet.sequence_number, client._player_id);
-  auto ackBuffer = std::make_shared<std::vector<uint8_t>>(
-      serialization::BitserySerializer::serialize(ackPacket));
-
-  server.getNetworkManager().sendToClient(
-      client._player_id, reinterpret_cast<const char *>(ackBuffer->data()),
-      ackBuffer->size());
   auto room = server.getGameManager().getRoom(packet.room_id);
   if (!room) {
     ResponseHelper::sendJoinRoomResponse(server, client, packet.sequence_number,
@@ -697,7 +666,7 @@ int packet::JoinRoomHandler::handlePacket(server::Server &server,
 int packet::LeaveRoomHandler::handlePacket(server::Server &server,
                                            server::Client &client,
                                            const char *data, std::size_t size) {
-  serialization::Buffer buffer(data, data + size);
+  auto buffer = serialization::asBytes(data, size);
 
   auto deserializedPacket =
       serialization::BitserySerializer::deserialize<LeaveRoomPacket>(buffer);
@@ -740,7 +709,7 @@ int packet::LeaveRoomHandler::handlePacket(server::Server &server,
 int packet::ListRoomHandler::handlePacket(server::Server &server,
                                           server::Client &client,
                                           const char *data, std::size_t size) {
-  serialization::Buffer buffer(data, data + size);
+  auto buffer = serialization::asBytes(data, size);
 
   auto deserializedPacket =
       serialization::BitserySerializer::deserialize<ListRoomPacket>(buffer);
@@ -783,12 +752,11 @@ int packet::ListRoomHandler::handlePacket(server::Server &server,
  * @brief Handle a matchmaking request and place the client into a matchmaking
  * room.
  *
- * Deserializes a MatchmakingRequestPacket, sends an acknowledgment for the
- * request, then attempts to join the client to an existing suitable room or
- * creates and joins a new matchmaking room. On success the client is
- * transitioned to IN_ROOM_WAITING, initialized in the room, and a success
- * matchmaking response is sent; on failure an appropriate error response is
- * sent and the client's state is restored where applicable.
+ * Deserializes a MatchmakingRequestPacket, then attempts to join the client to
+ * an existing suitable room or creates and joins a new matchmaking room. On
+ * success the client is transitioned to IN_ROOM_WAITING, initialized in the
+ * room, and a success matchmaking response is sent; on failure an appropriate
+ * error response is sent and the client's state is restored where applicable.
  *
  * @param server Server managing rooms, clients, and game state.
  * @param client Client issuing the matchmaking request; may be updated.
@@ -801,7 +769,7 @@ int packet::MatchmakingRequestHandler::handlePacket(server::Server &server,
                                                     server::Client &client,
                                                     const char *data,
                                                     std::size_t size) {
-  serialization::Buffer buffer(data, data + size);
+  auto buffer = serialization::asBytes(data, size);
 
   auto deserializedPacket =
       serialization::BitserySerializer::deserialize<MatchmakingRequestPacket>(
@@ -816,25 +784,19 @@ int packet::MatchmakingRequestHandler::handlePacket(server::Server &server,
 
   const MatchmakingRequestPacket &packet = deserializedPacket.value();
 
-  auto ackPacket =
-      PacketBuilder::makeAckPacket(packet.sequence_number, client._player_id);
-  auto ackBuffer = std::make_shared<std::vector<uint8_t>>(
-      serialization::BitserySerializer::serialize(ackPacket));
-
-  server.getNetworkManager().sendToClient(
-      client._player_id, reinterpret_cast<const char *>(ackBuffer->data()),
-      ackBuffer->size());
-
   auto sharedClient = server.getClientById(client._player_id);
   if (!sharedClient) {
     ResponseHelper::sendMatchmakingResponse(
         server, client, packet.sequence_number, RoomError::UNKNOWN_ERROR);
     return KO;
   }
-  bool joinSuccess = server.getGameManager().joinAnyRoom(sharedClient);
+  const std::size_t shard =
+      server.getNetworkManager().getClientShard(client._player_id);
+  bool joinSuccess = server.getGameManager().joinAnyRoom(sharedClient, shard);
 
   if (!joinSuccess) {
-    auto newRoom = server.getGameManager().createRoom("Matchmaking Room");
+    auto newRoom =
+        server.getGameManager().createRoom("Matchmaking Room", "", shard);
     if (!newRoom) {
       std::cerr << "[ERROR] Client " << client._player_id
                 << " failed to create new room for matchmaking" << std::endl;
@@ -893,8 +855,12 @@ int packet::MatchmakingRequestHandler::handlePacket(server::Server &server,
  * system.
  *
  * Deserializes a PlayerInputPacket from the provided buffer, validates the
- * client and room state, converts the packet into an ecs::PlayerInput, and
- * queues it in the room's ServerInputSystem for the client's entity.
+ * client and room state, expands its run-length encoded inputs into one
+ * ecs::PlayerInput per client tick, and queues them in the room's
+ * ServerInputSystem for the client's entity. Ticks already received through
+ * an earlier redundant packet are dropped by the input system, and ticks
+ * running ahead of the server tick by more than the jitter window are clamped
+ * (see ecs::ServerInputSystem::clampInputTick()).
  *
  * @param server Server instance used to access game and network managers.
  * @param client Client that sent the input; used to identify the player entity
@@ -904,13 +870,13 @@ int packet::MatchmakingRequestHandler::handlePacket(server::Server &server,
  * @param size Size of the raw packet data buffer in bytes.
  * @return int `OK` if the packet was deserialized and the input queued; `KO` on
  * error (deserialization failure, missing/inactive room, missing input system,
- * or invalid entity id).
+ * invalid entity id, or malformed input runs).
  */
 int packet::PlayerInputHandler::handlePacket(server::Server &server,
                                              server::Client &client,
                                              const char *data,
                                              std::size_t size) {
-  serialization::Buffer buffer(data, data + size);
+  auto buffer = serialization::asBytes(data, size);
 
   auto deserializedPacket =
       serialization::BitserySerializer::deserialize<PlayerInputPacket>(buffer);
@@ -936,62 +902,42 @@ int packet::PlayerInputHandler::handlePacket(server::Server &server,
     return KO;
   }
 
-  const ecs::PlayerInput packetInput = {
-      static_cast<MovementInputType>(packet.input),
-      static_cast<int>(packet.sequence_number)};
-
-  sis->queueInput(client._entity_id, packetInput);
-  return OK;
-}
-
-/**
- * @brief Handle an incoming AckPacket and mark the referenced sequence as
- * acknowledged for the sending client.
- *
- * Validates that the AckPacket's player_id matches the sender and removes the
- * acknowledged sequence number from the client's unacknowledged packet set.
- *
- * @param data Pointer to the serialized AckPacket bytes.
- * @param size Number of bytes available at `data`.
- * @return int `OK` on success, `KO` on failure (for example, deserialization
- * failure or player_id mismatch).
- */
-int packet::AckPacketHandler::handlePacket(server::Server &server,
-                                           server::Client &client,
-                                           const char *data, std::size_t size) {
-  serialization::Buffer buffer(data, data + size);
-
-  auto deserializedPacket =
-      serialization::BitserySerializer::deserialize<AckPacket>(buffer);
-
-  if (!deserializedPacket) {
-    std::cerr << "[ERROR] Failed to deserialize AckPacket from client "
-              << client._player_id << std::endl;
+  if (packet.run_count > MAX_INPUT_RUNS) {
     return KO;
   }
-
-  const AckPacket &packet = deserializedPacket.value();
-  if (packet.player_id != static_cast<std::uint32_t>(client._player_id)) {
-    std::cerr << "[WARNING] ACK player_id mismatch (packet=" << packet.player_id
-              << ", conn=" << client._player_id << ")" << std::endl;
+  std::uint32_t inputCount = 0;
+  for (std::uint8_t i = 0; i < packet.run_count; ++i) {
+    inputCount += packet.runs[i].count;
+  }
+  if (inputCount == 0 || inputCount > INPUT_REDUNDANCY ||
+      inputCount > packet.last_tick) {
+    return KO;
+  }
+  const std::uint32_t lastTick = sis->clampInputTick(
+      client._entity_id, packet.last_tick, room->getGame().getCurrentTick());
+  if (inputCount > lastTick) {
     return KO;
   }
 
-  client.removeAcknowledgedPacket(packet.sequence_number);
-
+  std::uint32_t tick = lastTick - inputCount + 1;
+  for (std::uint8_t i = 0; i < packet.run_count; ++i) {
+    const auto input = static_cast<MovementInputType>(packet.runs[i].input);
+    for (std::uint8_t n = 0; n < packet.runs[i].count; ++n) {
+      sis->queueInput(client._entity_id, {input, tick++});
+    }
+  }
   return OK;
 }
 
 /**
- * @brief Handle a RequestChallengePacket from a client: acknowledge the
- * request, generate a challenge for the client's room, send a
- * ChallengeResponse, and track the response as unacknowledged.
+ * @brief Handle a RequestChallengePacket from a client: generate a challenge
+ * for the client's room, send a ChallengeResponse, and track the response as
+ * unacknowledged.
  *
- * Validates packet deserialization and room existence. On success an AckPacket
- * for the incoming request is sent to the client, a challenge string is
- * created, a ChallengeResponse packet is built using the room's sequence
- * number, sent to the client, and the serialized response is stored as an
- * unacknowledged packet tied to the response's sequence number.
+ * Validates packet deserialization and room existence. On success a
+ * challenge string is created, a ChallengeResponse packet is built using the
+ * room's sequence number, sent to the client, and the serialized response is
+ * stored as an unacknowledged packet tied to the response's sequence number.
  *
  * @param server Server instance used for room lookup, challenge creation and
  * network I/O.
@@ -1006,7 +952,7 @@ int packet::RequestChallengeHandler::handlePacket(server::Server &server,
                                                   server::Client &client,
                                                   const char *data,
                                                   std::size_t size) {
-  serialization::Buffer buffer(data, data + size);
+  auto buffer = serialization::asBytes(data, size);
 
   auto deserializedPacket =
       serialization::BitserySerializer::deserialize<RequestChallengePacket>(
@@ -1021,15 +967,6 @@ int packet::RequestChallengeHandler::handlePacket(server::Server &server,
 
   const RequestChallengePacket &packet = deserializedPacket.value();
 
-  auto ackPacket =
-      PacketBuilder::makeAckPacket(packet.sequence_number, client._player_id);
-  auto ackBuffer = std::make_shared<std::vector<uint8_t>>(
-      serialization::BitserySerializer::serialize(ackPacket));
-
-  server.getNetworkManager().sendToClient(
-      client._player_id, reinterpret_cast<const char *>(ackBuffer->data()),
-      ackBuffer->size());
-
   auto room = server.getGameManager().getRoom(packet.room_id);
   if (!room) {
     std::cerr << "[ERROR] Room " << packet.room_id << " not found for "
@@ -1057,14 +994,12 @@ int packet::RequestChallengeHandler::handlePacket(server::Server &server,
     return KO;
   }
 
-  server.getNetworkManager().sendToClient(
-      client._player_id,
-      reinterpret_cast<const char *>(serializedBuffer.data()),
-      serializedBuffer.size());
+  auto responseBuffer = std::make_shared<std::vector<std::uint8_t>>(
+      std::move(serializedBuffer));
+  server.getNetworkManager().sendToClient(client._player_id, responseBuffer);
 
-  client.addUnacknowledgedPacket(
-      responsePacket.sequence_number,
-      std::make_shared<std::vector<std::uint8_t>>(serializedBuffer));
+  client.addUnacknowledgedPacket(responsePacket.sequence_number,
+                                 responseBuffer);
   return OK;
 }
 
@@ -1072,7 +1007,7 @@ int packet::ScoreboardRequestHandler::handlePacket(server::Server &server,
                                                    server::Client &client,
                                                    const char *data,
                                                    std::size_t size) {
-  serialization::Buffer buffer(data, data + size);
+  auto buffer = serialization::asBytes(data, size);
 
   auto deserializedPacket =
       serialization::BitserySerializer::deserialize<ScoreboardRequestPacket>(
@@ -1127,7 +1062,7 @@ int packet::ScoreboardRequestHandler::handlePacket(server::Server &server,
 int packet::PingHandler::handlePacket([[maybe_unused]] server::Server &server,
                                       server::Client &client, const char *data,
                                       std::size_t size) {
-  serialization::Buffer buffer(data, data + size);
+  auto buffer = serialization::asBytes(data, size);
 
   auto deserializedPacket =
       serialization::BitserySerializer::deserialize<PingPacket>(buffer);
@@ -1139,16 +1074,14 @@ int packet::PingHandler::handlePacket([[maybe_unused]] server::Server &server,
   }
 
   const PingPacket &packet = deserializedPacket.value();
-
   auto pongPacket =
       PacketBuilder::makePong(packet.timestamp, packet.sequence_number);
 
-  auto serializedBuffer =
-      serialization::BitserySerializer::serialize(pongPacket);
-  server.getNetworkManager().sendToClient(
-      client._player_id,
-      reinterpret_cast<const char *>(serializedBuffer.data()),
-      serializedBuffer.size());
+  auto serializedBuffer = server.getNetworkManager().acquireSendBuffer();
+  serialization::BitserySerializer::serializeInto(*serializedBuffer,
+                                                  pongPacket);
+  server.getNetworkManager().sendToClient(client._player_id,
+                                          serializedBuffer);
 
   return OK;
 }
@@ -102,12 +102,6 @@ namespace packet {
                        const char *data, std::size_t size) override;
   };
   
-  class AckPacketHandler : public APacket {
-    public:
-      int handlePacket(server::Server &server, server::Client &client,
-                       const char *data, std::size_t size) override;
-  };
-  
   class RequestChallengeHandler : public APacket {
     public:
       int handlePacket(server::Server &server, server::Client &client,
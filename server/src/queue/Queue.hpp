@@ -27,6 +27,14 @@ namespace queue {
         return true;
       }
 
+      /**
+       * @brief Drop every pending event.
+       */
+      void clear() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        std::queue<GameEvent>().swap(_queue);
+      }
+
     private:
       std::queue<GameEvent> _queue;
       mutable std::mutex _mutex;